@@ -0,0 +1,28 @@
+// Advancing many one-shot explosions at once
+
+#include <string>
+
+#include "benchHarness.h"
+#include "core/animation.h"
+
+namespace bench {
+    void animationBenchmarks(Harness &harness) {
+        using core::animation::AnimationSystem;
+        const components::Transform2D transform(0, 0, 60, 60);
+
+        // Animations without frames are never played
+        AnimationSystem::Play(assets::AnimationId::ASTEROID_EXPLOSION, transform);
+        if (AnimationSystem::GetActiveCount() == 0)
+            return;
+
+        for (const int count : {1000, 10000, 100000}) {
+            // Finished instances are topped up untimed, so every update sees the same count
+            harness.run("AnimationSystem::Update/" + std::to_string(count), count, [&] {
+                while (AnimationSystem::GetActiveCount() < count)
+                    AnimationSystem::Play(assets::AnimationId::ASTEROID_EXPLOSION, transform);
+            }, [] {
+                AnimationSystem::Update(1.f / 60);
+            });
+        }
+    }
+}
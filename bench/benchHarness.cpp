@@ -0,0 +1,50 @@
+#include "benchHarness.h"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "core/profiler.h"
+
+namespace bench {
+    void Harness::record(const std::string &name, const size_t items, std::vector<double> &samples) {
+        if (samples.empty())
+            return;
+
+        std::ranges::sort(samples);
+        const Result result {
+            name, items, static_cast<int>(samples.size()),
+            core::profiling::Percentile(samples, 0.5f), core::profiling::Percentile(samples, 0.99f),
+            samples.front(), samples.back()
+        };
+        print(result);
+        results_.push_back(result);
+    }
+
+    void Harness::print(const Result &result) {
+        const double perItem = result.items ? result.median / static_cast<double>(result.items) : 0;
+        std::printf("%-48s median %12.0f ns  p99 %12.0f ns  %10.1f ns/item\n",
+                    result.name.c_str(), result.median, result.p99, perItem);
+        std::fflush(stdout);
+    }
+
+    bool Harness::writeJson(const char *path) const {
+        FILE *file = std::fopen(path, "w");
+        if (!file)
+            return false;
+
+        std::fprintf(file, "{\"benchmarks\": [");
+        for (size_t i = 0; i < results_.size(); i++) {
+            const Result &result = results_[i];
+            // Names are plain ASCII without quotes, so no escaping
+            std::fprintf(file,
+                         "%s\n  {\"name\": \"%s\", \"items\": %zu, \"repetitions\": %d, "
+                         "\"median_ns\": %.1f, \"p99_ns\": %.1f, \"min_ns\": %.1f, \"max_ns\": %.1f, "
+                         "\"median_ns_per_item\": %.3f}",
+                         i ? "," : "", result.name.c_str(), result.items, result.repetitions,
+                         result.median, result.p99, result.min, result.max,
+                         result.items ? result.median / static_cast<double>(result.items) : 0.0);
+        }
+        std::fprintf(file, "\n]}\n");
+        return std::fclose(file) == 0;
+    }
+}
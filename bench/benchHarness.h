@@ -0,0 +1,100 @@
+#ifndef BENCHHARNESS_H
+#define BENCHHARNESS_H
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bench {
+    struct Options {
+        /// Untimed runs before measuring, to fill caches and grow containers
+        int warmup = 3;
+        int repetitions = 50;
+        /// Only benchmarks whose name contains this run
+        std::string filter;
+    };
+
+    /// Timings of one benchmark over all repetitions, in nanoseconds
+    struct Result {
+        std::string name;
+        /// Units of work done by one repetition (collider pairs, objects...)
+        size_t items;
+        int repetitions;
+        double median;
+        double p99;
+        double min;
+        double max;
+    };
+
+    /// Keeps the compiler from dropping a computation whose result is unused
+    template<typename T>
+    void doNotOptimize(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static const volatile T *s_sink;
+        s_sink = &value;
+#endif
+    }
+
+    class Harness {
+        Options options_;
+        std::vector<Result> results_;
+
+        void record(const std::string &name, size_t items, std::vector<double> &samples);
+    public:
+        explicit Harness(Options options): options_(std::move(options)) {}
+
+        [[nodiscard]] bool isEnabled(const std::string &name) const {
+            return options_.filter.empty() || name.find(options_.filter) != std::string::npos;
+        }
+
+        /// Times body() once per repetition. setup() runs before each call, untimed,
+        /// for state the body consumes (objects to destroy, finished animations...)
+        template<typename Setup, typename Body>
+        void run(const std::string &name, const size_t items, Setup &&setup, Body &&body) {
+            if (!isEnabled(name))
+                return;
+
+            for (int i = 0; i < options_.warmup; i++) {
+                setup();
+                body();
+            }
+
+            std::vector<double> samples;
+            samples.reserve(options_.repetitions);
+            for (int i = 0; i < options_.repetitions; i++) {
+                setup();
+                const auto start = std::chrono::steady_clock::now();
+                body();
+                const auto end = std::chrono::steady_clock::now();
+                samples.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+            }
+            record(name, items, samples);
+        }
+
+        template<typename Body>
+        void run(const std::string &name, const size_t items, Body &&body) {
+            run(name, items, [] {}, std::forward<Body>(body));
+        }
+
+        [[nodiscard]] const std::vector<Result> &getResults() const { return results_; }
+
+        /// One line per benchmark, as results come in
+        static void print(const Result &result);
+
+        /// {"benchmarks": [{"name", "items", "repetitions", "median_ns", "p99_ns", ...}]}
+        bool writeJson(const char *path) const;
+    };
+
+    // Suites, one per file
+    void collisionBenchmarks(Harness &harness);
+    void physicsBenchmarks(Harness &harness);
+    void managementBenchmarks(Harness &harness);
+    void animationBenchmarks(Harness &harness);
+    void snapshotBenchmarks(Harness &harness);
+}
+
+#endif //BENCHHARNESS_H
@@ -0,0 +1,60 @@
+// Microbenchmarks of engine hot paths, linked against the null backend like game_headless.
+// Usage: game_bench [--filter SUBSTRING] [--repetitions N] [--warmup N] [--json FILE]
+// Build with optimizations (-DCMAKE_BUILD_TYPE=Release), numbers from debug builds mean little
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "benchHarness.h"
+#include "core/animation.h"
+#include "raylib.h"
+
+namespace {
+    bool parseOptions(const int argc, char **argv, bench::Options &options, std::string &json) {
+        for (int i = 1; i < argc; i++) {
+            const bool hasValue = i + 1 < argc;
+            if (!std::strcmp(argv[i], "--filter") && hasValue)
+                options.filter = argv[++i];
+            else if (!std::strcmp(argv[i], "--repetitions") && hasValue)
+                options.repetitions = std::atoi(argv[++i]);
+            else if (!std::strcmp(argv[i], "--warmup") && hasValue)
+                options.warmup = std::atoi(argv[++i]);
+            else if (!std::strcmp(argv[i], "--json") && hasValue)
+                json = argv[++i];
+            else
+                return false;
+        }
+        return options.repetitions > 0 && options.warmup >= 0;
+    }
+}
+
+int main(const int argc, char **argv) {
+    bench::Options options;
+    std::string json;
+    if (!parseOptions(argc, argv, options, json)) {
+        std::fprintf(stderr, "Usage: %s [--filter SUBSTRING] [--repetitions N] [--warmup N] [--json FILE]\n",
+                     argv[0]);
+        return 1;
+    }
+
+    InitWindow(1, 1, "bench");
+    core::animation::AnimationSystem::LoadAll();
+
+    bench::Harness harness(options);
+    bench::collisionBenchmarks(harness);
+    bench::physicsBenchmarks(harness);
+    bench::managementBenchmarks(harness);
+    bench::animationBenchmarks(harness);
+    bench::snapshotBenchmarks(harness);
+
+    core::animation::AnimationSystem::UnloadAll();
+    CloseWindow();
+
+    if (!json.empty() && !harness.writeJson(json.c_str())) {
+        std::fprintf(stderr, "Failed to write %s\n", json.c_str());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,35 @@
+#include "benchScene.h"
+
+#include <cmath>
+#include <random>
+
+#include "game/gameObjectManager.h"
+#include "game/physicsWorld.h"
+
+namespace bench {
+    std::vector<std::shared_ptr<game::game_objects::Asteroid>> spawnAsteroidField(const size_t count,
+                                                                                 const unsigned int seed) {
+        std::mt19937 random(seed);
+        const float side = std::sqrt(static_cast<float>(count) * AREA_PER_ASTEROID);
+        std::uniform_real_distribution<float> position(0, side);
+        std::uniform_real_distribution<float> size(20, 60);
+        std::uniform_real_distribution<float> speed(50, 100);
+        std::uniform_real_distribution<float> angle(0, 2 * PI);
+
+        auto &manager = game::management::GameObjectManager::getInstance();
+        return manager.createObjects<game::game_objects::Asteroid>(count, [&](size_t) {
+            const float diameter = size(random);
+            auto asteroid = std::make_shared<game::game_objects::Asteroid>(
+                components::Transform2D(position(random), position(random), diameter, diameter),
+                10, 1000, speed(random));
+            const float direction = angle(random);
+            asteroid->setDirectionOfSpeed({std::cos(direction), std::sin(direction)});
+            return asteroid;
+        });
+    }
+
+    void clearScene() {
+        game::physics::PhysicsWorld::Clear();
+        game::management::GameObjectManager::getInstance().destroyAll();
+    }
+}
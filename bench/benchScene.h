@@ -0,0 +1,22 @@
+#ifndef BENCHSCENE_H
+#define BENCHSCENE_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "game/gameObjects.h"
+#include "game/entities/units.h"
+
+namespace bench {
+    /// Average area per asteroid: about what the arena has, so overlap rate stays fixed as count grows
+    constexpr float AREA_PER_ASTEROID = 150 * 150;
+
+    /// Create count moving asteroids scattered over a square sized for AREA_PER_ASTEROID
+    std::vector<std::shared_ptr<game::game_objects::Asteroid>> spawnAsteroidField(size_t count, unsigned int seed);
+
+    /// Destroy every object the manager owns and forget the broad-phase built from them
+    void clearScene();
+}
+
+#endif //BENCHSCENE_H
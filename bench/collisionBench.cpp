@@ -0,0 +1,89 @@
+// GJK and EPA for every pair of collider shapes
+
+#include <cmath>
+#include <memory>
+#include <random>
+
+#include "benchHarness.h"
+#include "components.h"
+
+namespace bench {
+    namespace {
+        constexpr float SHAPE_RADIUS = 20;
+        /// Placements per repetition. They fill a disc slightly larger than touching
+        /// distance, so most pairs pass broad-phase and a part of them miss
+        constexpr size_t PLACEMENTS = 1024;
+        constexpr float PLACEMENT_RADIUS = 2.2f * SHAPE_RADIUS;
+
+        enum class Shape { RECT, CIRCLE, POLY };
+
+        const char *shapeName(const Shape shape) {
+            switch (shape) {
+                case Shape::RECT: return "rect";
+                case Shape::CIRCLE: return "circle";
+                case Shape::POLY: return "poly";
+            }
+            return "";
+        }
+
+        std::unique_ptr<components::Collider> makeCollider(const Shape shape, const Vector2 center) {
+            switch (shape) {
+                case Shape::RECT:
+                    return std::make_unique<components::ColliderRect>(
+                        Vector2 {center.x - SHAPE_RADIUS, center.y - SHAPE_RADIUS},
+                        Vector2 {2 * SHAPE_RADIUS, 2 * SHAPE_RADIUS});
+                case Shape::CIRCLE:
+                    return std::make_unique<components::ColliderCircle>(center, SHAPE_RADIUS);
+                case Shape::POLY: {
+                    // Hexagon, same as asteroids would use
+                    std::vector<Vector2> vertices;
+                    for (int i = 0; i < 6; i++) {
+                        const float angle = static_cast<float>(i) * PI / 3;
+                        vertices.push_back({center.x + SHAPE_RADIUS * std::cos(angle),
+                                            center.y + SHAPE_RADIUS * std::sin(angle)});
+                    }
+                    return std::make_unique<components::ColliderPoly>(center, vertices);
+                }
+            }
+            return nullptr;
+        }
+    }
+
+    void collisionBenchmarks(Harness &harness) {
+        constexpr Shape shapes[] = {Shape::RECT, Shape::CIRCLE, Shape::POLY};
+
+        std::mt19937 random(1);
+        std::uniform_real_distribution<float> unit(-1, 1);
+        std::vector<Vector2> offsets;
+        while (offsets.size() < PLACEMENTS) {
+            const Vector2 offset = {unit(random), unit(random)};
+            if (offset.x * offset.x + offset.y * offset.y <= 1)
+                offsets.push_back({offset.x * PLACEMENT_RADIUS, offset.y * PLACEMENT_RADIUS});
+        }
+
+        for (size_t a = 0; a < std::size(shapes); a++) {
+            for (size_t b = a; b < std::size(shapes); b++) {
+                const std::string pair = std::string(shapeName(shapes[a])) + "-" + shapeName(shapes[b]);
+
+                const auto first = makeCollider(shapes[a], {0, 0});
+                std::vector<std::unique_ptr<components::Collider>> others;
+                for (const Vector2 offset : offsets)
+                    others.push_back(makeCollider(shapes[b], offset));
+
+                harness.run("gjk/" + pair, PLACEMENTS, [&] {
+                    int hits = 0;
+                    for (const auto &other : others)
+                        hits += first->checkCollision(*other);
+                    doNotOptimize(hits);
+                });
+
+                harness.run("gjk+epa/" + pair, PLACEMENTS, [&] {
+                    Vector2 sum = {0, 0};
+                    for (const auto &other : others)
+                        sum = Vector2Add(sum, first->getCollisionNormal(*other));
+                    doNotOptimize(sum);
+                });
+            }
+        }
+    }
+}
@@ -0,0 +1,67 @@
+// Object lifetime: creation and destruction through the manager, and pooled reuse
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchHarness.h"
+#include "benchScene.h"
+#include "core/objectPool.h"
+#include "game/gameObjectManager.h"
+
+namespace bench {
+    namespace {
+        /// Objects created and destroyed per repetition
+        constexpr size_t CHURN_COUNT = 1000;
+        constexpr size_t POOL_SIZE = 4096;
+    }
+
+    void managementBenchmarks(Harness &harness) {
+        auto &manager = game::management::GameObjectManager::getInstance();
+
+        // Removal scans the manager's lists, so cost depends on how many objects stay alive
+        for (const size_t resident : {0, 10000}) {
+            const std::string suffix = "/" + std::to_string(CHURN_COUNT) + "+" + std::to_string(resident);
+            const auto residents = spawnAsteroidField(resident, 2);
+
+            std::vector<std::shared_ptr<game::game_objects::Asteroid>> churned;
+            churned.reserve(CHURN_COUNT);
+            harness.run("createObject" + suffix, CHURN_COUNT, [&] {
+                churned.clear();
+                manager.destroyObjectsToDestroy();
+            }, [&] {
+                for (size_t i = 0; i < CHURN_COUNT; i++) {
+                    churned.push_back(manager.createObject<game::game_objects::Asteroid>(
+                        components::Transform2D(0, 0, 40, 40), 10, 100));
+                    churned.back()->destroy();
+                }
+            });
+            churned.clear();
+            manager.destroyObjectsToDestroy();
+
+            harness.run("destroyObjectsToDestroy" + suffix, CHURN_COUNT, [&] {
+                for (size_t i = 0; i < CHURN_COUNT; i++) {
+                    manager.createObject<game::game_objects::Asteroid>(
+                        components::Transform2D(0, 0, 40, 40), 10, 100)->destroy();
+                }
+            }, [&] {
+                manager.destroyObjectsToDestroy();
+            });
+            clearScene();
+        }
+
+        core::object_pool::ObjectPool<components::Transform2D> pool;
+        std::vector<std::shared_ptr<components::Transform2D>> taken;
+        taken.reserve(POOL_SIZE);
+        for (size_t i = 0; i < POOL_SIZE; i++)
+            pool.release(std::make_shared<components::Transform2D>(components::Transform2DZero()));
+
+        harness.run("ObjectPool acquire+release/" + std::to_string(POOL_SIZE), POOL_SIZE, [&] {
+            while (!pool.isEmpty())
+                taken.push_back(pool.acquire());
+            for (auto &object : taken)
+                pool.release(std::move(object));
+            taken.clear();
+        });
+    }
+}
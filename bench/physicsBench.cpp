@@ -0,0 +1,24 @@
+// One fixed physics step over fields of moving asteroids
+
+#include <string>
+
+#include "benchHarness.h"
+#include "benchScene.h"
+#include "game/gameLoop.h"
+
+namespace bench {
+    void physicsBenchmarks(Harness &harness) {
+        for (const size_t count : {100, 1000, 10000, 50000}) {
+            const std::string name = "updatePhysics/" + std::to_string(count);
+            if (!harness.isEnabled(name))
+                continue;
+
+            // Kept across repetitions: asteroids keep moving and bouncing as in game
+            const auto asteroids = spawnAsteroidField(count, 1);
+            harness.run(name, count, [] {
+                game::loop::updatePhysics();
+            });
+            clearScene();
+        }
+    }
+}
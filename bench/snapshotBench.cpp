@@ -0,0 +1,41 @@
+// World snapshots: saving the whole simulation into a blob and restoring it, as restart does.
+// Effects still playing from earlier suites are saved too; run with --filter Snapshot for world alone
+
+#include <cmath>
+#include <string>
+
+#include "benchHarness.h"
+#include "benchScene.h"
+#include "core/snapshot.h"
+#include "game/gameObjectManager.h"
+#include "game/levelManager.h"
+
+namespace bench {
+    void snapshotBenchmarks(Harness &harness) {
+        auto &manager = game::management::GameObjectManager::getInstance();
+
+        for (const int count : {1000, 10000}) {
+            game::management::LevelSettings settings;
+            settings.asteroidCount = count;
+            // Asteroids are sampled within 0.9 of the radius
+            settings.worldRadius = std::sqrt(static_cast<float>(count) * AREA_PER_ASTEROID / PI) / 0.9f;
+            const auto level = manager.createObject<game::management::LevelManager>(settings);
+            const std::string suffix = "/" + std::to_string(level->getAsteroidCount());
+
+            core::snapshot::Blob blob;
+            harness.run("saveSnapshot" + suffix, level->getAsteroidCount(), [&] {
+                level->saveSnapshot(blob);
+                doNotOptimize(blob.data());
+            });
+
+            const core::snapshot::Blob levelStart = blob;
+            harness.run("restoreSnapshot" + suffix, level->getAsteroidCount(), [&] {
+                doNotOptimize(level->restoreSnapshot(levelStart));
+            });
+
+            clearScene();
+            // Level registers its player with the manager but does not own it
+            delete game::game_objects::Player::GetInstance();
+        }
+    }
+}
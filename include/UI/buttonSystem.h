@@ -3,68 +3,85 @@
 
 #include "raylib.h"
 #include "components.h"
+#include "core/textureAtlas.h"
+#include "assetManifest.h"
 #include <unordered_map>
 #include <functional>
 #include <memory>
 
 namespace core::button {
+    /// Index of a button in ButtonSystem. Stays valid until UnloadAll
+    using ButtonHandle = int;
+    constexpr ButtonHandle INVALID_BUTTON = -1;
+
+    enum ButtonState {
+        NORMAL = 0,
+        MOUSE_HOVER = 1,
+        PRESSED = 2
+    };
+
     struct Button {
-        std::vector<Texture2D> frames;
-        Rectangle bounds;
-        int btnState = 0; // Button state: 0-NORMAL, 1-MOUSE_HOVER, 2-PRESSED
+        /// Whole sheet; frames are source rects in it, one per btnState. Unused if page is set
+        Texture2D texture {};
+        /// Atlas page, resolved at draw time since it may still be streaming
+        int page = -1;
+        std::vector<Rectangle> frames;
+        bool ownsTexture = false;
+        Rectangle bounds;  // Screen space, used for hit testing
+        int btnState = NORMAL;
         std::function<void()> onClick = []() {};
         bool is_Invisible = true;
-
-        //Button(const Button&) = delete;
-        //Button& operator=(const Button&) = delete;
-
-        ////   
-        //Button(Button&& other) noexcept;
-        //Button& operator=(Button&& other) noexcept;
-
-
-        //Button(const char* texturePath,
-        //    const std::pair<int, int>& framesCount,
-        //    const Rectangle& bounds,
-        //    std::function<void()> onClick);
-
-        //~Button();
-
-        //const int getButtonState() {
-        //    return btnState;
-        //}
-
-        //void setButtonState(int state) {
-        //    btnState = state;
-        //}
-
-        //const Rectangle getBounds() {
-        //    return bounds;
-        //}
-
-        //void setBounds(Rectangle b) {
-        //    bounds = b;
-        //}
-
     };
 
+    /// Buttons live in a dense array addressed by handles. Hit testing runs only on mouse events,
+    /// list of visible buttons is cached and rebuilt when visibility or bounds change
 	class ButtonSystem {
-        static  std::unordered_map<std::string, Button> buttons;
+        static std::vector<Button> buttons;
+        /// Button ids are assets::fnv1a of a name, computed at compile time. Resolved once, at load
+        static std::unordered_map<uint32_t, ButtonHandle> buttonIds;
+
+        /// Cached layout: visible buttons in draw order with their offset from anchor
+        static std::vector<ButtonHandle> visibleButtons;
+        static std::vector<Vector2> drawOffsets;
+        static bool layoutDirty;
+
+        /// Mouse state at last hit test
+        static Vector2 lastMousePosition;
+        static ButtonHandle hoveredButton;
+
+        static ButtonHandle define(uint32_t id, Button btn);
+        static void rebuildLayout();
+        static void hitTest(Vector2 mousePoint, bool released);
+        static bool isValid(const ButtonHandle handle) {
+            return handle >= 0 && handle < static_cast<int>(buttons.size());
+        }
 	public:
-        static void Load(const std::string& name,
+        /// Loading an id again replaces that button and keeps its handle
+        static ButtonHandle Load(uint32_t id,
             const char* texturePath,
             const std::pair<int, int>& framesCount,
             const Rectangle& bounds,
             std::function<void()> onClick,
             bool is_Invisible = true);
 
+        static ButtonHandle Load(uint32_t id,
+            const atlas::AtlasRegion& sheet,
+            const std::pair<int, int>& framesCount,
+            const Rectangle& bounds,
+            std::function<void()> onClick,
+            bool is_Invisible = true);
+
+        /// INVALID_BUTTON if no button with such id
+        static ButtonHandle GetHandle(uint32_t id);
+
+        /// Hit test against core::input::Input, so it runs on the simulation thread
         static void Update();
+        /// Submits visible buttons to render queue on UI layer, centered on relative
         static void Draw(const components::Transform2D& relative);
         static void UnloadAll();
-        static void setInvisibility(const std::string& name, bool is_Invisible);
-        static void setBounds(const std::string& name, Rectangle bounds);
-
-        static bool IsButtonPressed(const std::string& name);
 
+        static void setInvisibility(ButtonHandle handle, bool is_Invisible);
+        static void setBounds(ButtonHandle handle, Rectangle bounds);
+        static bool IsButtonPressed(ButtonHandle handle);
 	};
 }
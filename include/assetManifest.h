@@ -0,0 +1,109 @@
+#ifndef ASSETMANIFEST_H
+#define ASSETMANIFEST_H
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+/// Sprites packed into the atlas: id, name, file in assets/textures, sheet rows, sheet columns
+#define ASSET_TEXTURES(X) \
+    X(PLAYER, "player", "spaceship.png", 1, 1) \
+    X(ASTEROID, "asteroid", "asteroid.png", 1, 1) \
+    X(PLAYER_EXPLOSION, "playerExplosion", "explosion.png", 5, 5) \
+    X(ASTEROID_EXPLOSION, "asteroidExplosion", "asteroid-explosion-spritesheetType3.png", 3, 3) \
+    X(RESTART_BUTTON, "restartButton", "button1.png", 3, 1)
+
+/// Animations: id, name, sheet (id from ASSET_TEXTURES), frame duration, looping
+#define ASSET_ANIMATIONS(X) \
+    X(PLAYER_EXPLOSION, "playerExplosion", PLAYER_EXPLOSION, 0.04f, false) \
+    X(ASTEROID_EXPLOSION, "asteroidExplosion", ASTEROID_EXPLOSION, 0.04f, false)
+
+/// Asset manifest expanded from the lists above. Ids are dense indices, names only matter
+/// for files written by tools and are matched by hash
+namespace assets {
+    /// 32-bit FNV-1a
+    constexpr uint32_t fnv1a(const std::string_view text) {
+        uint32_t hash = 2166136261u;
+        for (const char c : text) {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    enum class TextureId : uint16_t {
+#define X(id, name, file, rows, columns) id,
+        ASSET_TEXTURES(X)
+#undef X
+    };
+
+    enum class AnimationId : uint16_t {
+#define X(id, name, sheet, frameDuration, looping) id,
+        ASSET_ANIMATIONS(X)
+#undef X
+    };
+
+#define X(...) +1
+    constexpr size_t TEXTURE_COUNT = 0 ASSET_TEXTURES(X);
+    constexpr size_t ANIMATION_COUNT = 0 ASSET_ANIMATIONS(X);
+#undef X
+
+    struct TextureInfo {
+        std::string_view name;
+        uint32_t hash;
+        const char *path;
+        int rows;
+        int columns;
+    };
+
+    struct AnimationInfo {
+        std::string_view name;
+        uint32_t hash;
+        TextureId sheet;
+        float frameDuration;
+        bool looping;
+    };
+
+    inline constexpr std::array<TextureInfo, TEXTURE_COUNT> TEXTURES = {{
+#define X(id, name, file, rows, columns) {name, fnv1a(name), PROJECT_ROOT_PATH "/assets/textures/" file, rows, columns},
+        ASSET_TEXTURES(X)
+#undef X
+    }};
+
+    inline constexpr std::array<AnimationInfo, ANIMATION_COUNT> ANIMATIONS = {{
+#define X(id, name, sheet, frameDuration, looping) {name, fnv1a(name), TextureId::sheet, frameDuration, looping},
+        ASSET_ANIMATIONS(X)
+#undef X
+    }};
+
+    constexpr size_t index(const TextureId id) { return static_cast<size_t>(id); }
+    constexpr size_t index(const AnimationId id) { return static_cast<size_t>(id); }
+
+    constexpr const TextureInfo &info(const TextureId id) { return TEXTURES[index(id)]; }
+    constexpr const AnimationInfo &info(const AnimationId id) { return ANIMATIONS[index(id)]; }
+
+    /// Index of entry named name, size of table if there is none
+    template<typename Info, size_t N>
+    constexpr size_t find(const std::array<Info, N> &table, const std::string_view name) {
+        const uint32_t hash = fnv1a(name);
+        for (size_t i = 0; i < N; i++) {
+            if (table[i].hash == hash && table[i].name == name)
+                return i;
+        }
+        return N;
+    }
+
+    template<typename Info, size_t N>
+    consteval bool hashesUnique(const std::array<Info, N> &table) {
+        for (size_t i = 0; i < N; i++) {
+            for (size_t j = i + 1; j < N; j++) {
+                if (table[i].hash == table[j].hash) return false;
+            }
+        }
+        return true;
+    }
+
+    static_assert(hashesUnique(TEXTURES) && hashesUnique(ANIMATIONS), "Asset name hash collision, rename one");
+}
+
+#endif //ASSETMANIFEST_H
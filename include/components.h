@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "raymath.h"
+#include "core/textureAtlas.h"
 
 namespace components {
     /// Info about position and sizes
@@ -37,12 +38,26 @@ namespace components {
     }
 
 
+    /// GJK simplex. In 2D it never grows past a triangle, so it lives on the stack
+    struct Simplex {
+        Vector2 points[3];
+        int size = 0;
+
+        void push(const Vector2 point) { points[size++] = point; }
+        void erase(const int index) {
+            for (int i = index; i < size - 1; i++)
+                points[i] = points[i + 1];
+            size--;
+        }
+        Vector2 &operator[](const int index) { return points[index]; }
+        const Vector2 &operator[](const int index) const { return points[index]; }
+    };
+
     struct Collider {
-        friend Vector2 EPA(Collider &colliderA, Collider &colliderB,
-                           const std::vector<Vector2> &simplex);
+        friend Vector2 EPA(Collider &colliderA, Collider &colliderB, const Simplex &simplex);
     protected:
         /// Used in case you need simplex after check
-        bool checkCollision(Collider &other, std::vector<Vector2>& simplex);
+        bool checkCollision(Collider &other, Simplex &simplex);
 
         /// <seealso href="https://en.wikipedia.org/wiki/Gilbert%E2%80%93Johnson%E2%80%93Keerthi_distance_algorithm"/>
         /// GJK algorithm support point
@@ -57,6 +72,14 @@ namespace components {
         virtual ~Collider() = default;
         Vector2 getCollisionNormal(Collider &other);
 
+        /// Box containing collider, for broad-phase
+        Rectangle getBounds() { return getCoveringBox(); }
+
+        /// Sweeps circle of given radius from `from` to `to`. On hit fraction is set to the
+        /// first touching point along segment, from 0 to 1. Base version tests covering box,
+        /// so it is conservative for shapes without exact override
+        virtual bool intersectsSegment(Vector2 from, Vector2 to, float radius, float &fraction);
+
         /// Set center (used by collider as pivot)
         virtual void setCenter(Vector2 center) = 0;
 
@@ -101,6 +124,8 @@ namespace components {
         Rectangle getCoveringBox() override;
         Rectangle getInnerBox() override;
 
+        bool intersectsSegment(Vector2 from, Vector2 to, float radius, float &fraction) override;
+
         void rotate(float angle) override;
     };
 
@@ -127,6 +152,9 @@ namespace components {
 
         void rotate(float angle) override;
 
+        /// Replace vertices, given relative to center
+        void setOffsets(const std::vector<Vector2>& offsets) { offsets_ = offsets; }
+
         std::vector<Vector2> getVertices() {
             std::vector<Vector2> vertices;
             for (const auto& offset : offsets_) {
@@ -144,6 +172,9 @@ namespace components {
     public:
         virtual ~DrawnObject() = default;
         virtual void draw() = 0;
+
+        [[nodiscard]] int getWorldLayer() const { return worldLayer_; }
+        void setWorldLayer(const int layer) { worldLayer_ = layer; }
     };
 
     struct GameCamera {
@@ -167,15 +198,23 @@ namespace components {
         Texture2D texture;
         Color tint;
         Rectangle sourceRect;
+        /// Set if texture lives in atlas; then texture is not owned and the page is looked up
+        /// when the batch is drawn, as it may still be streaming in
+        core::atlas::AtlasRegion region;
+
+        void submit(const Rectangle& dest, Vector2 origin, float rotation, int layer) const;
 
     public:
         TextureComponent(const char* path, Color tint = WHITE);
+        explicit TextureComponent(const core::atlas::AtlasRegion& region, Color tint = WHITE);
         ~TextureComponent();
 
+        TextureComponent(const TextureComponent&) = delete;
+        TextureComponent& operator=(const TextureComponent&) = delete;
 
-        Texture2D getTexture() const;
-        void Draw(const Transform2D& transform) const;
-        void Draw(const Transform2D& transform, float angle ) const;
+        /// Submits sprite to render queue on given layer
+        void Draw(const Transform2D& transform, int layer = 0) const;
+        void Draw(const Transform2D& transform, float angle, int layer) const;
         void SetTint(Color newTint) { tint = newTint; }
     };
 }
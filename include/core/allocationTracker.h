@@ -0,0 +1,80 @@
+#ifndef ALLOCATIONTRACKER_H
+#define ALLOCATIONTRACKER_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace core::memory {
+    /// What heap allocations are charged to. Set per thread by AllocationScope
+    enum class AllocationTag : uint8_t {
+        UNTAGGED,
+        PHYSICS,
+        LOGIC,
+        EFFECTS,
+        RENDER,
+        UI,
+        ASSETS,
+        COUNT
+    };
+
+    constexpr size_t ALLOCATION_TAG_COUNT = static_cast<size_t>(AllocationTag::COUNT);
+
+    const char *tagName(AllocationTag tag);
+
+    /// One tag over one frame. Frees are charged to the tag that allocated
+    struct AllocationStats {
+        uint64_t allocations = 0;
+        uint64_t frees = 0;
+        uint64_t bytes = 0;
+        /// Still allocated at frame end
+        uint64_t liveBytes = 0;
+        uint64_t peakLiveBytes = 0;
+    };
+
+    /// Counts every operator new and delete of the process when built with GAME_ALLOC_TRACKER:
+    /// replaced global operators keep size and tag in a small header before each block.
+    /// C allocations (raylib's image and texture data) are not seen. Without the option
+    /// nothing is replaced and all stats stay zero
+    class AllocationTracker {
+    public:
+#ifdef GAME_ALLOC_TRACKER
+        static constexpr bool ENABLED = true;
+#else
+        static constexpr bool ENABLED = false;
+#endif
+
+        /// Frame boundaries, called on main thread next to the profiler's
+        static void BeginFrame();
+        static void EndFrame();
+
+        /// Stats of last finished frame
+        static const AllocationStats &GetLastFrame(AllocationTag tag);
+        static AllocationStats GetLastFrameTotal();
+
+        /// Table of last frame per tag. Returns its height, zero if nothing was drawn
+        static int DrawOverlay(int x, int y);
+    };
+
+    /// Charges allocations of current thread to tag until destroyed, then restores previous one
+    class AllocationScope {
+        AllocationTag previous_;
+    public:
+        explicit AllocationScope(AllocationTag tag);
+        ~AllocationScope();
+
+        AllocationScope(const AllocationScope &) = delete;
+        AllocationScope &operator=(const AllocationScope &) = delete;
+    };
+}
+
+#ifdef GAME_ALLOC_TRACKER
+#define ALLOCATION_CONCAT_IMPL(a, b) a##b
+#define ALLOCATION_CONCAT(a, b) ALLOCATION_CONCAT_IMPL(a, b)
+/// Charge allocations in rest of enclosing scope to core::memory::AllocationTag::tag
+#define ALLOCATION_SCOPE(tag) \
+    const core::memory::AllocationScope ALLOCATION_CONCAT(allocationScope_, __LINE__)(core::memory::AllocationTag::tag)
+#else
+#define ALLOCATION_SCOPE(tag) ((void)0)
+#endif
+
+#endif //ALLOCATIONTRACKER_H
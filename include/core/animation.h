@@ -3,46 +3,74 @@
 
 #include "raylib.h"
 #include "components.h" // For Transform2D
+#include "core/textureAtlas.h"
+#include "core/snapshot.h"
+#include "assetManifest.h"
+#include <array>
 #include <vector>
-#include <unordered_map>
-#include <string>
 
 namespace core::animation {
+    /// Shared definition of an animation. Playback state lives in AnimationInstance
     struct Animation {
-        std::vector<Texture2D> frames;
+        /// Whole sheet; frames index into it. Unused if page is set
+        Texture2D texture {};
+        /// Atlas page, resolved at draw time since it may still be streaming
+        int page = -1;
+        std::vector<Rectangle> frames;
+        bool ownsTexture = false;
         float frameDuration;
-        int currentFrame = 0;
-        float frameTime = 0;
         bool looping = true;
         bool flipX = false;
         bool flipY = false;
     };
 
+    /// One playing copy of an animation
+    struct AnimationInstance {
+        assets::AnimationId animation;
+        int currentFrame = 0;
+        float frameTime = 0;
+        components::Transform2D transform = components::Transform2DZero();
+    };
+
     class AnimationSystem {
 
-        static std::unordered_map<std::string, Animation> animations;
-        static std::vector<std::pair<std::string, components::Transform2D>> activeAnimations;
+        /// Indexed by assets::AnimationId
+        static std::array<Animation, assets::ANIMATION_COUNT> animations;
+        /// Dense pool: finished instances are swap-removed, capacity is kept
+        static std::vector<AnimationInstance> activeAnimations;
+
+        static void define(assets::AnimationId id, Animation anim);
 
     public:
+        static constexpr size_t INSTANCE_POOL_CAPACITY = 1024;
+
         // Load animation from sprite sheet
-        static void Load(const std::string& name,
+        static void Load(assets::AnimationId id,
             const char* spriteSheetPath,
             const std::pair<int, int> &framesCount,
             float frameDuration,
             bool looping = true);
 
-        // Play animation with Transform2D
-        static void Play(const std::string& name, components::Transform2D transform);
+        // Load animation from sprite sheet packed in atlas
+        static void Load(assets::AnimationId id,
+            const atlas::AtlasRegion& spriteSheet,
+            const std::pair<int, int> &framesCount,
+            float frameDuration,
+            bool looping = true);
+
+        // Start a new instance of animation with Transform2D
+        static void Play(assets::AnimationId id, const components::Transform2D &transform);
 
         // Set flip options for an animation
-        static void SetFlip(const std::string& name, bool flipX, bool flipY);
+        static void SetFlip(assets::AnimationId id, bool flipX, bool flipY);
 
-        // Update all animations
+        // Advance all instances, dropping finished ones
         static void Update(float deltaTime);
 
-        // Draw all animations
+        // Submit all active animations to render queue
         static void Draw();
 
+        /// Load every animation in asset manifest
         static void LoadAll();
 
         // Cleanup resources
@@ -50,11 +78,15 @@ namespace core::animation {
 
 
 
-        // Check if animation is playing
-        static bool IsPlaying(const std::string& name);
+        /// Playing instances. Definitions are assets and are not saved
+        static void SaveState(snapshot::SnapshotWriter &writer);
+        static bool LoadState(snapshot::SnapshotReader &reader);
+
+        // Check if any instance of animation is playing
+        static bool IsPlaying(assets::AnimationId id);
 
         static int GetActiveCount() { return static_cast<int>(activeAnimations.size()); }
     };
 }
 
-#endif
\ No newline at end of file
+#endif
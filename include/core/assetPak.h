@@ -0,0 +1,117 @@
+#ifndef ASSETPAK_H
+#define ASSETPAK_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "raylib.h"
+#include "assetManifest.h"
+#include "core/textureAtlas.h"
+
+/// Cooked asset file: atlas pages as raw GPU-ready pixels plus regions, frame tables and
+/// animation definitions. Written offline by asset_cooker, mapped and uploaded at startup.
+/// Layout: PakHeader, PakPage[], PakRegion[], PakRect[] (frames), PakAnimation[], then pixel
+/// data of every page at PAK_DATA_ALIGNMENT. All values are little-endian
+namespace core::pak {
+    constexpr uint32_t PAK_MAGIC = 0x4B415041;  // "APAK"
+    constexpr uint32_t PAK_VERSION = 1;
+    constexpr size_t PAK_NAME_SIZE = 32;
+    constexpr size_t PAK_DATA_ALIGNMENT = 64;
+
+    struct PakHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t pageCount;
+        uint32_t regionCount;
+        uint32_t frameCount;
+        uint32_t animationCount;
+    };
+
+    struct PakPage {
+        uint32_t width;
+        uint32_t height;
+        int32_t format;  // raylib PixelFormat
+        uint32_t reserved;
+        uint64_t offset;  // From start of file
+        uint64_t size;
+    };
+
+    struct PakRect {
+        float x, y, width, height;
+    };
+
+    struct PakRegion {
+        char id[PAK_NAME_SIZE];
+        int32_t page;
+        PakRect rect;
+        /// Range in frame table
+        uint32_t firstFrame;
+        uint32_t frameCount;
+    };
+
+    struct PakAnimation {
+        char name[PAK_NAME_SIZE];
+        uint32_t region;
+        float frameDuration;
+        uint32_t looping;
+    };
+
+    static_assert(sizeof(PakHeader) == 24 && sizeof(PakPage) == 32 && sizeof(PakRect) == 16 &&
+                  sizeof(PakRegion) == 60 && sizeof(PakAnimation) == 44, "Pak layout must not depend on compiler");
+
+    /// Image to cook and its sprite sheet layout
+    struct SheetSource {
+        std::string id;
+        std::string path;
+        int rows = 1;
+        int columns = 1;
+    };
+
+    struct AnimationSource {
+        std::string name;
+        std::string sheet;  // SheetSource id
+        float frameDuration;
+        bool looping;
+    };
+
+    /// Animation read from pak, frames are rects in atlas page
+    struct AnimationDef {
+        std::string name;
+        int page;
+        std::vector<Rectangle> frames;
+        float frameDuration;
+        bool looping;
+    };
+
+    /// Pack sheets into atlas pages and write them to path together with frame tables and animations
+    bool Cook(const std::vector<SheetSource> &sheets, const std::vector<AnimationSource> &animations,
+              const std::string &path);
+
+    class AssetPak {
+        /// Indexed by assets::TextureId
+        static std::array<std::vector<Rectangle>, assets::TEXTURE_COUNT> s_frames;
+        static std::vector<AnimationDef> s_animations;
+        static bool s_loaded;
+    public:
+        /// Map pak and upload its pages into TextureAtlas. Returns false if file is missing
+        /// or invalid, then nothing is changed and sources have to be loaded instead
+        static bool Load(const std::string &path);
+
+        /// Forget frame tables and animations. Pages belong to TextureAtlas
+        static void Unload();
+
+        [[nodiscard]] static bool IsLoaded() { return s_loaded; }
+
+        /// Frame table of a sheet, empty if sheet was not cooked
+        [[nodiscard]] static const std::vector<Rectangle> &GetFrames(const assets::TextureId id) {
+            return s_frames[assets::index(id)];
+        }
+
+        [[nodiscard]] static const std::vector<AnimationDef> &GetAnimations() { return s_animations; }
+    };
+}
+
+#endif //ASSETPAK_H
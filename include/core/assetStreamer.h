@@ -0,0 +1,93 @@
+#ifndef ASSETSTREAMER_H
+#define ASSETSTREAMER_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "raylib.h"
+
+namespace core::streaming {
+    /// Index of a request in AssetStreamer. Stays valid until Shutdown
+    using StreamHandle = int;
+    constexpr StreamHandle INVALID_STREAM = -1;
+
+    enum StreamState {
+        QUEUED,   // Waiting for a worker or being decoded
+        DECODED,  // Waiting for main thread upload
+        READY,
+        FAILED,
+        RELEASED
+    };
+
+    /// Decodes images on worker threads, main thread uploads them in Update under a time budget.
+    /// Until a texture is ready GetTexture returns a placeholder, so callers can draw right away
+    class AssetStreamer {
+        struct Request {
+            StreamHandle handle;
+            std::string path;
+            bool upload;
+            /// Runs on worker right after decode, e.g. to convert pixel format
+            std::function<void(Image &)> prepare;
+            Image image {};
+            Texture2D texture {};
+            StreamState state = QUEUED;
+        };
+
+        /// Deque keeps element addresses while new requests are added
+        static std::deque<Request> s_requests;
+        static std::deque<Request *> s_decodeQueue;
+        static std::deque<StreamHandle> s_uploadQueue;
+        static std::vector<std::thread> s_workers;
+        static std::mutex s_mutex;
+        static std::condition_variable s_wakeUp;
+        static bool s_stopping;
+        static Texture2D s_placeholder;
+
+        static StreamHandle enqueue(const std::string &path, bool upload, std::function<void(Image &)> prepare);
+        static void workerLoop();
+        static void decode(Request &request);
+    public:
+        /// Default main thread time per frame spent on uploads, in seconds
+        static constexpr double UPLOAD_BUDGET = 0.002;
+
+        /// workerCount 0 picks one from hardware concurrency
+        static void Init(unsigned int workerCount = 0);
+
+        /// Stops workers and unloads everything that was streamed
+        static void Shutdown();
+
+        /// Decode image at path and upload it as texture
+        static StreamHandle RequestTexture(const std::string &path);
+
+        /// Decode image at path and keep it on CPU, prepare runs on the worker thread
+        static StreamHandle RequestImage(const std::string &path, std::function<void(Image &)> prepare = {});
+
+        /// Unload texture or image of a request; one still in flight is dropped when it arrives
+        static void Release(StreamHandle handle);
+
+        /// Upload decoded images until budget (seconds) is spent. At least one upload is always done
+        static void Update(double budget = UPLOAD_BUDGET);
+
+        /// Block until every request is ready or failed
+        static void Flush();
+
+        [[nodiscard]] static StreamState GetState(StreamHandle handle);
+        [[nodiscard]] static bool IsReady(const StreamHandle handle) { return GetState(handle) == READY; }
+
+        /// Streamed texture, placeholder while it is not ready or if it failed
+        [[nodiscard]] static Texture2D GetTexture(StreamHandle handle);
+
+        /// Take ownership of a ready CPU image; later calls return an empty image
+        [[nodiscard]] static Image TakeImage(StreamHandle handle);
+
+        [[nodiscard]] static Texture2D GetPlaceholder() { return s_placeholder; }
+        [[nodiscard]] static int GetPendingCount();
+    };
+}
+
+#endif //ASSETSTREAMER_H
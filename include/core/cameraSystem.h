@@ -10,6 +10,9 @@ namespace core::systems {
             game::game_objects::GameObject& target,
             float deltaTime);
 
+        /// World rect currently seen through camera
+        static Rectangle GetVisibleRect(const components::GameCamera& camera);
+
         static void BeginCameraDraw(const components::GameCamera& camera);
         static void EndCameraDraw();
     };
@@ -0,0 +1,46 @@
+#ifndef INPUT_H
+#define INPUT_H
+
+#include <bitset>
+#include <mutex>
+
+#include "raylib.h"
+
+namespace core::input {
+    /// Keyboard and mouse as one simulation tick sees them
+    struct InputState {
+        static constexpr int KEY_COUNT = 512;
+        static constexpr int BUTTON_COUNT = MOUSE_BUTTON_MIDDLE + 1;
+
+        std::bitset<KEY_COUNT> keysDown;
+        /// Edges are collected over every frame since last tick, so a tap is never lost
+        std::bitset<KEY_COUNT> keysPressed;
+        std::bitset<BUTTON_COUNT> buttonsDown;
+        std::bitset<BUTTON_COUNT> buttonsPressed;
+        std::bitset<BUTTON_COUNT> buttonsReleased;
+        Vector2 mousePosition {0, 0};
+    };
+
+    /// raylib polls input on the window thread, game logic runs on the simulation one.
+    /// Window thread captures raylib state every frame, simulation takes what was captured
+    /// at the start of a tick and reads only that until the next one
+    class Input {
+        static InputState s_pending;
+        static InputState s_current;
+        static std::mutex s_mutex;
+    public:
+        /// Window thread, once per frame after raylib polled events
+        static void Capture();
+        /// Simulation thread, before anything reads input in this tick
+        static void BeginTick();
+
+        [[nodiscard]] static bool IsKeyDown(int key);
+        [[nodiscard]] static bool IsKeyPressed(int key);
+        [[nodiscard]] static bool IsMouseButtonDown(int button);
+        [[nodiscard]] static bool IsMouseButtonPressed(int button);
+        [[nodiscard]] static bool IsMouseButtonReleased(int button);
+        [[nodiscard]] static Vector2 GetMousePosition() { return s_current.mousePosition; }
+    };
+}
+
+#endif //INPUT_H
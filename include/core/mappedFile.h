@@ -0,0 +1,32 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+namespace core::mapped_file {
+    /// Read-only memory mapping of a whole file. Unmapped on destruction
+    class MappedFile {
+        const std::byte *data_ = nullptr;
+        size_t size_ = 0;
+#ifdef _WIN32
+        void *file_ = nullptr;
+        void *mapping_ = nullptr;
+#endif
+    public:
+        MappedFile() = default;
+        MappedFile(const MappedFile &other) = delete;
+        MappedFile &operator=(const MappedFile &other) = delete;
+        ~MappedFile() { close(); }
+
+        /// Returns false if file does not exist, is empty or cannot be mapped
+        bool open(const std::string &path);
+        void close();
+
+        [[nodiscard]] bool isOpen() const { return data_ != nullptr; }
+        [[nodiscard]] const std::byte *data() const { return data_; }
+        [[nodiscard]] size_t size() const { return size_; }
+    };
+}
+
+#endif //MAPPEDFILE_H
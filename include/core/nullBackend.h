@@ -0,0 +1,27 @@
+#ifndef NULLBACKEND_H
+#define NULLBACKEND_H
+
+#include <string>
+
+/// Controls for the null raylib backend linked into headless targets instead of raylib.
+/// There drawing and texture loads are no-ops, time is fixed and input comes from a script
+namespace core::headless {
+    /// Value GetFrameTime returns. Also advances GetTime every frame
+    void SetFrameTime(float frameTime);
+
+    /// Script of input events, one per line: "<frame> <key> down|up",
+    /// "<frame> mouse <x> <y>" or "<frame> mouse_left down|up".
+    /// Keys are raylib key codes or names without KEY_ prefix (W, SPACE, LEFT_CONTROL...).
+    /// '#' starts a comment. Returns false if the file could not be read or parsed
+    bool LoadInputScript(const std::string &path);
+
+    /// Set key state directly, for code driving the simulation itself
+    void SetKeyDown(int key, bool down);
+
+    /// Start next frame: advance time and apply scripted events for it
+    void BeginFrame();
+
+    [[nodiscard]] unsigned long GetFrameIndex();
+}
+
+#endif //NULLBACKEND_H
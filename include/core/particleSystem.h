@@ -0,0 +1,98 @@
+#ifndef PARTICLESYSTEM_H
+#define PARTICLESYSTEM_H
+
+#include <cstdint>
+#include <vector>
+
+#include "raylib.h"
+#include "core/snapshot.h"
+
+namespace core::particles {
+    /// How spawned particles look and move. Ranges are picked uniformly
+    struct ParticleParams {
+        Color color = WHITE;
+        float minSpeed = 50;
+        float maxSpeed = 150;
+        float minLife = 0.3f;
+        float maxLife = 0.8f;
+        float minSize = 2;
+        float maxSize = 5;
+        /// Full cone angle in radians around emit direction. 2*PI for all directions
+        float spread = 2 * PI;
+        /// Fraction of speed kept after one second
+        float drag = 0.3f;
+    };
+
+    using EmitterHandle = int;
+    constexpr EmitterHandle INVALID_EMITTER = -1;
+
+    /// Continuous source owned by an entity. Owner moves and re-arms it every frame
+    /// it should emit, so emitters of dead or inactive owners go quiet by themselves
+    struct Emitter {
+        ParticleParams params;
+        Vector2 position {0, 0};
+        Vector2 direction {1, 0};
+        float rate = 0;  // Particles per second
+        float accumulator = 0;
+        bool active = false;
+        bool alive = false;
+    };
+
+    /// Particles are kept in structure-of-arrays pools of fixed capacity, so update is
+    /// a few linear (SSE when available) passes and the cost is bounded no matter how
+    /// many effects spawn. Spawns over capacity are dropped
+    class ParticleSystem {
+        static std::vector<float> s_posX;
+        static std::vector<float> s_posY;
+        static std::vector<float> s_velX;
+        static std::vector<float> s_velY;
+        static std::vector<float> s_life;
+        static std::vector<float> s_invMaxLife;
+        static std::vector<float> s_size;
+        static std::vector<float> s_drag;
+        static std::vector<Color> s_color;
+        static size_t s_count;
+
+        static std::vector<Emitter> s_emitters;
+        static std::vector<EmitterHandle> s_freeEmitters;
+
+        static uint32_t s_randomState;
+
+        static float random(float min, float max);
+        static void spawn(Vector2 position, Vector2 direction, const ParticleParams &params);
+        static void integrate(float deltaTime);
+        static void removeDead();
+    public:
+        static constexpr size_t DEFAULT_CAPACITY = 16384;
+
+        static void Init(size_t capacity = DEFAULT_CAPACITY);
+        static void Shutdown();
+
+        /// Spawn count particles at once
+        static void Burst(Vector2 position, int count, const ParticleParams &params,
+                          Vector2 direction = {1, 0});
+
+        static EmitterHandle CreateEmitter(const ParticleParams &params, float rate);
+        static void DestroyEmitter(EmitterHandle handle);
+        static void SetEmitterTransform(EmitterHandle handle, Vector2 position, Vector2 direction);
+        /// Active flag is reset after every Update
+        static void SetEmitterActive(EmitterHandle handle, bool active);
+
+        static void Update(float deltaTime);
+
+        /// Submit visible particles to render queue as one batch of quads
+        static void Draw();
+
+        static void Clear();
+
+        /// Live particles, emitters and random state. Pools must be initialized with a
+        /// capacity that fits what was saved
+        static void SaveState(snapshot::SnapshotWriter &writer);
+        static bool LoadState(snapshot::SnapshotReader &reader);
+
+        [[nodiscard]] static size_t GetCount() { return s_count; }
+        [[nodiscard]] static size_t GetCapacity() { return s_posX.size(); }
+    };
+}
+
+#endif //PARTICLESYSTEM_H
@@ -0,0 +1,71 @@
+#ifndef PHYSICSSTATS_H
+#define PHYSICSSTATS_H
+
+#include <array>
+#include <cstdint>
+
+namespace core::physics_stats {
+    /// Counts of small values in power of two buckets: 0, 1, 2-3, 4-7, ... and the rest
+    struct Histogram {
+        static constexpr int BUCKETS = 12;
+
+        std::array<uint32_t, BUCKETS> buckets {};
+        uint32_t count = 0;
+        uint64_t sum = 0;
+        uint32_t max = 0;
+
+        void add(uint32_t value);
+
+        [[nodiscard]] float mean() const { return count ? static_cast<float>(sum) / static_cast<float>(count) : 0; }
+        /// Upper bound of the bucket holding given fraction of values
+        [[nodiscard]] uint32_t percentile(float p) const;
+    };
+
+    /// What one physics step did, from broad-phase down to pushing bodies apart
+    struct StepStats {
+        /// Candidate pairs broad-phase handed to narrow-phase
+        uint32_t broadPhasePairs = 0;
+        /// Collider::checkCollision calls, both directions of every pair and queries count
+        uint32_t narrowPhaseTests = 0;
+        /// Tests that ended on covering boxes not overlapping
+        uint32_t aabbRejects = 0;
+        /// Tests that ended on inner boxes overlapping, without GJK
+        uint32_t innerBoxAccepts = 0;
+        uint32_t contacts = 0;
+        Histogram gjkIterations;
+        Histogram epaIterations;
+        /// Nudges CollidingObject::resolveCollision needed per call
+        Histogram pushApartSteps;
+    };
+
+    /// Counters of the narrow-phase, collected when built with GAME_PROFILER. Not thread safe:
+    /// collision code runs on the simulation thread only
+    class PhysicsStats {
+        static StepStats s_current;
+        static StepStats s_lastStep;
+    public:
+        /// Step boundaries, called by PhysicsWorld::Step. Tests outside a step are not kept
+        static void BeginStep() { s_current = {}; }
+        static void EndStep() { s_lastStep = s_current; }
+
+        /// Written to by the collision code through PHYSICS_COUNT
+        static StepStats &Current() { return s_current; }
+
+        [[nodiscard]] static const StepStats &GetLastStep() { return s_lastStep; }
+
+        /// Counters and histograms of last step in screen space. Returns height drawn
+        static int DrawOverlay(int x, int y) { return DrawOverlay(s_lastStep, x, y); }
+        /// Same for a copy, e.g. one taken on simulation thread and drawn on another
+        static int DrawOverlay(const StepStats &stats, int x, int y);
+    };
+}
+
+#ifdef GAME_PROFILER
+/// Run statement against current StepStats, e.g. PHYSICS_COUNT(stats.contacts++)
+#define PHYSICS_COUNT(statement) \
+    do { [[maybe_unused]] auto &stats = core::physics_stats::PhysicsStats::Current(); statement; } while (false)
+#else
+#define PHYSICS_COUNT(statement) ((void)0)
+#endif
+
+#endif //PHYSICSSTATS_H
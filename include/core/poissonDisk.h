@@ -0,0 +1,53 @@
+#ifndef POISSONDISK_H
+#define POISSONDISK_H
+
+#include <vector>
+
+#include "raylib.h"
+
+namespace core::poisson_disk {
+    /// Poisson-disk sampler in a circle: every new point is at least minDistance away from
+    /// other points and from obstacles. Uniform dart throwing first, then Bridson's
+    /// expansion around accepted points fills what is left. Neighbour checks go through
+    /// a grid with at most one point per cell, and attempts are bounded, so sampling
+    /// takes O(count * ATTEMPTS) even when the circle is full
+    class PoissonDiskSampler {
+        Vector2 center_;
+        float radius_;
+        float minDistance_;
+        float cellSize_;
+        int gridSize_;
+
+        /// Point index per cell, -1 if empty
+        std::vector<int> grid_;
+        std::vector<Vector2> points_;
+
+        struct Exclusion {
+            Vector2 center;
+            float radius;
+        };
+        std::vector<Exclusion> exclusions_;
+
+        [[nodiscard]] int cellOf(float coordinate, float origin) const;
+        [[nodiscard]] bool isFree(Vector2 point) const;
+        void insert(Vector2 point);
+    public:
+        /// Candidates tried per point before giving up on it
+        static constexpr int ATTEMPTS = 30;
+        /// Darts missing this many times in a row mean the circle is crowded
+        static constexpr int MAX_DART_MISSES = 4 * ATTEMPTS;
+
+        PoissonDiskSampler(Vector2 center, float radius, float minDistance);
+
+        /// Already placed object, new points keep minDistance from it
+        void addObstacle(Vector2 point);
+
+        /// Area with no points at all, e.g. around the player
+        void addExclusion(Vector2 center, float radius);
+
+        /// Appends up to count new points to out; fewer if the circle is full. Uses GetRandomValue
+        size_t sample(size_t count, std::vector<Vector2> &out);
+    };
+}
+
+#endif //POISSONDISK_H
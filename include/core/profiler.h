@@ -0,0 +1,97 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace core::profiling {
+    /// Steady clock in nanoseconds
+    uint64_t Now();
+
+    /// Value at index floor(p * (n - 1)) of a sorted, non-empty sample, p in [0, 1]: the lower of
+    /// the two samples around the p-quantile, not interpolated. Shared so all reports agree
+    template<typename T>
+    T Percentile(const std::vector<T> &sorted, const float p) {
+        return sorted[static_cast<size_t>(p * static_cast<float>(sorted.size() - 1))];
+    }
+
+    /// Per-frame time of one zone over recent frames of the thread it ran on, in milliseconds
+    struct ZoneStats {
+        const char *thread;
+        const char *name;
+        float p50;
+        float p95;
+        float p99;
+        float max;
+    };
+
+    /// Time one zone took over a single frame, in milliseconds
+    struct ZoneSample {
+        const char *name;
+        float time;
+    };
+
+    /// Zones are written into a ring buffer owned by the thread that ran them, so
+    /// recording takes no locks. Zones of threads calling BeginFrame / EndFrame are summed per
+    /// frame into that thread's rolling history for the overlay; all rings make a trace export
+    class Profiler {
+    public:
+        static constexpr size_t EVENTS_PER_THREAD = 1 << 16;
+        /// Frames percentiles are taken over
+        static constexpr size_t HISTORY_FRAMES = 240;
+        /// Frames written by ExportTrace
+        static constexpr size_t EXPORT_FRAMES = 120;
+
+        /// Shown in trace viewer. Call from the thread being named
+        static void SetThreadName(const char *name);
+
+        /// Name must stay valid for the program lifetime, e.g. a string literal
+        static void Record(const char *name, uint64_t start, uint64_t end);
+
+        /// Frame boundaries of the calling thread. Every thread that calls them gets its own
+        /// rolling history: window thread per drawn frame, simulation per tick
+        static void BeginFrame();
+        static void EndFrame();
+
+        static void ToggleOverlay();
+        [[nodiscard]] static bool IsOverlayVisible();
+        /// Table of zone percentiles in screen space. Returns its height, zero if hidden
+        static int DrawOverlay(int x, int y);
+
+        /// Rolling percentiles of every zone seen on threads that have frames, grouped by thread
+        /// in order of their first profiler call, zones in first seen order
+        static void GetZoneStats(std::vector<ZoneStats> &out);
+
+        /// Totals of calling thread's last finished frame for every zone it ran so far, zero for
+        /// those that did not run. For collecting more frames than the rolling history keeps
+        static void GetLastFrame(std::vector<ZoneSample> &out);
+
+        /// Write every thread's events over the calling thread's last EXPORT_FRAMES frames as
+        /// Chrome trace_event JSON
+        static bool ExportTrace(const char *path);
+    };
+
+    /// Records time from construction to destruction
+    class Zone {
+        const char *name_;
+        uint64_t start_;
+    public:
+        explicit Zone(const char *name): name_(name), start_(Now()) {}
+        ~Zone() { Profiler::Record(name_, start_, Now()); }
+
+        Zone(const Zone &) = delete;
+        Zone &operator=(const Zone &) = delete;
+    };
+}
+
+#ifdef GAME_PROFILER
+#define PROFILER_CONCAT_IMPL(a, b) a##b
+#define PROFILER_CONCAT(a, b) PROFILER_CONCAT_IMPL(a, b)
+/// Time rest of enclosing scope under given name
+#define PROFILE_ZONE(name) const core::profiling::Zone PROFILER_CONCAT(profileZone_, __LINE__)(name)
+#else
+#define PROFILE_ZONE(name) ((void)0)
+#endif
+
+#endif //PROFILER_H
@@ -0,0 +1,45 @@
+#ifndef RENDERCULLING_H
+#define RENDERCULLING_H
+
+#include <vector>
+
+#include "game/gameObjects.h"
+
+namespace core::render {
+    struct CullingStats {
+        int drawn = 0;
+        int culled = 0;
+    };
+
+    /// Skips draw() of everything outside camera view.
+    /// Bodies are found through the physics broad-phase queried with the visible rect, so cost
+    /// follows what is on screen; only objects without a collider are tested one by one
+    class RenderCulling {
+        /// Query buffer, grown when a view holds more bodies
+        static std::vector<game::game_objects::CollidingObject*> s_candidates;
+        static Rectangle s_view;
+        static CullingStats s_stats;
+        static CullingStats s_lastStats;
+
+    public:
+        /// How far a sprite may reach past its collider's bounds. Bodies are searched this far outside the view
+        static constexpr float BODY_DRAW_MARGIN = 64.f;
+
+        /// Resets counters and sets visible world rect for the frame
+        static void BeginFrame(const Rectangle &view);
+        static void EndFrame();
+
+        /// Calls draw() of every active object overlapping the view. Broad-phase must be current
+        /// (after a physics Step or Sync); unindexed are drawn objects without a collider, total
+        /// counts all drawn objects for the culled count
+        static void DrawVisible(const std::vector<game::game_objects::DrawnGameObject*> &unindexed, size_t total);
+
+        /// Counts bounds as drawn or culled. For systems that submit sprites themselves
+        static bool IsVisible(const Rectangle &bounds);
+
+        [[nodiscard]] static const Rectangle &GetView() { return s_view; }
+        [[nodiscard]] static const CullingStats &GetLastStats() { return s_lastStats; }
+    };
+}
+
+#endif //RENDERCULLING_H
@@ -0,0 +1,108 @@
+#ifndef RENDERQUEUE_H
+#define RENDERQUEUE_H
+
+#include <cstdint>
+#include <vector>
+
+#include "raylib.h"
+
+namespace core::render {
+    /// World layers used as the primary sort key. Lower is drawn first
+    enum RenderLayer {
+        BACKGROUND = 0,
+        WORLD = 1,
+        ENTITIES = 2,
+        PLAYER = 3,
+        EFFECTS = 4,
+        /// World-space UI anchored to entities, above everything
+        UI = 5
+    };
+
+    /// Everything needed to draw one textured quad
+    struct SpriteRecord {
+        Texture2D texture;
+        Rectangle source;
+        Rectangle dest;
+        Vector2 origin;
+        float rotation;
+        Color tint;
+        int layer;
+        /// Atlas page to draw from instead of texture, -1 for none. Resolved when the batch
+        /// is drawn: streamed pages are only safe to read on the window thread
+        int page = -1;
+    };
+
+    /// Circle outline, drawn under all sprites like borders were when drawn immediately
+    struct CircleRecord {
+        Vector2 center;
+        float radius;
+        Color color;
+    };
+
+    /// Everything submitted over one frame, sprites already in draw order.
+    /// Can be drawn later and on another thread than the one that collected it
+    struct RenderBatch {
+        std::vector<SpriteRecord> sprites;
+        std::vector<CircleRecord> circles;
+
+        void clear() {
+            sprites.clear();
+            circles.clear();
+        }
+    };
+
+    struct RenderStats {
+        int sprites = 0;
+        int batches = 0;  // Texture switches issued on last flush
+    };
+
+    /// Collects sprites during the frame and draws them sorted by (layer, texture),
+    /// so consecutive sprites share one texture bind and one rlgl draw call.
+    /// Every thread has its own queue: simulation records a frame, window thread draws it
+    class RenderQueue {
+        static thread_local std::vector<SpriteRecord> s_sprites;
+        static thread_local std::vector<CircleRecord> s_circles;
+        static thread_local std::vector<uint32_t> s_keys;
+        static thread_local std::vector<uint32_t> s_order;
+        static thread_local std::vector<uint32_t> s_keysTmp;
+        static thread_local std::vector<uint32_t> s_orderTmp;
+        static thread_local RenderBatch s_flushBatch;
+        static thread_local RenderStats s_lastStats;
+
+        static void sortByKey();
+        static void emitQuad(const SpriteRecord &sprite, const Texture2D &texture);
+
+    public:
+        /// Same arguments as DrawTexturePro plus the layer
+        static void Submit(const Texture2D &texture, const Rectangle &source,
+                           const Rectangle &dest, Vector2 origin, float rotation,
+                           Color tint, int layer);
+
+        static void Submit(const SpriteRecord &sprite);
+
+        /// Sprite from an atlas page, for code that may run off the window thread
+        static void SubmitPage(int page, const Rectangle &source, const Rectangle &dest, Vector2 origin,
+                               float rotation, Color tint, int layer);
+
+        /// Outline of a circle. Replaces DrawCircleLines for code that may not draw directly
+        static void SubmitCircleLines(Vector2 center, float radius, Color color);
+
+        /// Draw everything submitted since last flush. Must be called between Begin/EndDrawing
+        static void Flush();
+
+        /// Sort everything submitted since last flush into batch instead of drawing it.
+        /// Batch is overwritten; its vectors keep their capacity
+        static void Take(RenderBatch &batch);
+
+        /// Draw a taken batch. Must be called between Begin/EndDrawing
+        static void Draw(const RenderBatch &batch);
+
+        /// Drop submitted sprites without drawing them
+        static void Clear();
+
+        [[nodiscard]] static int GetPendingCount() { return static_cast<int>(s_sprites.size()); }
+        [[nodiscard]] static const RenderStats &GetLastStats() { return s_lastStats; }
+    };
+}
+
+#endif //RENDERQUEUE_H
@@ -0,0 +1,102 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace core::snapshot {
+    /// Flat image of simulation state. Values only, never pointers, so a blob can be copied,
+    /// kept or sent anywhere and restored into other objects than the ones it was taken from
+    using Blob = std::vector<std::byte>;
+
+    template <typename T>
+    concept Plain = std::is_trivially_copyable_v<T>;
+
+    /// Appends values to a blob as raw bytes. Arrays go as count and one memcpy
+    class SnapshotWriter {
+        Blob &blob_;
+    public:
+        /// Blob keeps its capacity, so writing the same state again does not allocate
+        explicit SnapshotWriter(Blob &blob): blob_(blob) { blob_.clear(); }
+
+        template <Plain T>
+        void write(const T &value) {
+            writeBytes(&value, sizeof(T));
+        }
+
+        template <Plain T>
+        void writeArray(const T *values, const size_t count) {
+            write(static_cast<uint64_t>(count));
+            writeBytes(values, count * sizeof(T));
+        }
+
+        template <Plain T>
+        void writeVector(const std::vector<T> &values) {
+            writeArray(values.data(), values.size());
+        }
+
+        void writeBytes(const void *data, const size_t size) {
+            const size_t offset = blob_.size();
+            blob_.resize(offset + size);
+            if (size > 0)
+                std::memcpy(blob_.data() + offset, data, size);
+        }
+    };
+
+    /// Reads back what SnapshotWriter wrote, in the same order. Reading past the end or an
+    /// array longer than asked for fails the reader; every later read fails as well
+    class SnapshotReader {
+        const std::byte *data_;
+        size_t size_;
+        size_t offset_ = 0;
+        bool failed_ = false;
+
+        bool readBytes(void *out, const size_t size) {
+            if (failed_ || size > size_ - offset_) {
+                failed_ = true;
+                return false;
+            }
+            if (size > 0)
+                std::memcpy(out, data_ + offset_, size);
+            offset_ += size;
+            return true;
+        }
+    public:
+        explicit SnapshotReader(const Blob &blob): data_(blob.data()), size_(blob.size()) {}
+
+        template <Plain T>
+        bool read(T &value) {
+            return readBytes(&value, sizeof(T));
+        }
+
+        /// Array written with writeArray into storage of maxCount elements. Returns count read
+        template <Plain T>
+        size_t readArray(T *values, const size_t maxCount) {
+            uint64_t count = 0;
+            if (!read(count) || count > maxCount) {
+                failed_ = true;
+                return 0;
+            }
+            return readBytes(values, count * sizeof(T)) ? count : 0;
+        }
+
+        template <Plain T>
+        bool readVector(std::vector<T> &values) {
+            uint64_t count = 0;
+            if (!read(count) || count * sizeof(T) > size_ - offset_) {
+                failed_ = true;
+                return false;
+            }
+            values.resize(count);
+            return readBytes(values.data(), count * sizeof(T));
+        }
+
+        [[nodiscard]] bool failed() const { return failed_; }
+        [[nodiscard]] bool atEnd() const { return offset_ == size_; }
+    };
+}
+
+#endif //SNAPSHOT_H
@@ -0,0 +1,82 @@
+#ifndef SPATIALGRID_H
+#define SPATIALGRID_H
+
+#include <cstdint>
+#include <vector>
+
+#include "raylib.h"
+
+namespace core::spatial {
+    /// Uniform grid hashed into a fixed bucket table. Items are plain indices with
+    /// bounds; owner keeps its own index -> object mapping.
+    /// Usage: clear(), insert() everything, build(), then query() any number of times
+    class SpatialGrid {
+        float cellSize_;
+        uint32_t bucketMask_;
+
+        std::vector<Rectangle> bounds_;
+        /// (bucket, item) pairs collected by insert, sorted into entries_ by build
+        std::vector<std::pair<uint32_t, uint32_t>> pending_;
+        std::vector<uint32_t> cellStart_;
+        std::vector<uint32_t> cursor_;
+        std::vector<uint32_t> entries_;
+        /// Items covering too many cells, always tested
+        std::vector<uint32_t> oversized_;
+
+        mutable std::vector<uint32_t> marks_;
+        mutable uint32_t queryStamp_ = 0;
+
+        [[nodiscard]] uint32_t bucketOf(int cellX, int cellY) const {
+            const auto hash = static_cast<uint32_t>(cellX) * 73856093u ^ static_cast<uint32_t>(cellY) * 19349663u;
+            return hash & bucketMask_;
+        }
+
+        void cellRange(const Rectangle &area, int &x0, int &y0, int &x1, int &y1) const;
+
+        /// Returns false if item was already visited by current query
+        bool mark(uint32_t item) const;
+        void nextStamp() const;
+    public:
+        static constexpr int MAX_CELLS_PER_ITEM = 64;
+
+        /// bucketCount is rounded up to power of two
+        explicit SpatialGrid(float cellSize, uint32_t bucketCount = 4096);
+
+        void clear();
+
+        /// Returns item index (insertion order, starting from zero)
+        uint32_t insert(const Rectangle &bounds);
+
+        void build();
+
+        [[nodiscard]] size_t size() const { return bounds_.size(); }
+        [[nodiscard]] float getCellSize() const { return cellSize_; }
+        [[nodiscard]] const Rectangle &getBounds(const uint32_t item) const { return bounds_[item]; }
+
+        /// Calls visit(item) once for every item whose bounds overlap area
+        template<typename Visitor>
+        void query(const Rectangle &area, Visitor &&visit) const {
+            nextStamp();
+
+            int x0, y0, x1, y1;
+            cellRange(area, x0, y0, x1, y1);
+            for (int cy = y0; cy <= y1; cy++) {
+                for (int cx = x0; cx <= x1; cx++) {
+                    const uint32_t bucket = bucketOf(cx, cy);
+                    for (uint32_t i = cellStart_[bucket]; i < cellStart_[bucket + 1]; i++) {
+                        const uint32_t item = entries_[i];
+                        if (mark(item) && CheckCollisionRecs(bounds_[item], area))
+                            visit(item);
+                    }
+                }
+            }
+
+            for (const uint32_t item : oversized_) {
+                if (CheckCollisionRecs(bounds_[item], area))
+                    visit(item);
+            }
+        }
+    };
+}
+
+#endif //SPATIALGRID_H
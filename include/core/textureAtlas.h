@@ -0,0 +1,103 @@
+#ifndef TEXTUREATLAS_H
+#define TEXTUREATLAS_H
+
+#include <array>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "raylib.h"
+#include "assetManifest.h"
+#include "core/assetStreamer.h"
+
+namespace core::atlas {
+    /// Sub-rectangle of one atlas page
+    struct AtlasRegion {
+        int page = -1;
+        Rectangle rect {0, 0, 0, 0};
+
+        [[nodiscard]] bool isValid() const { return page >= 0; }
+    };
+
+    /// Source rects of a rows x columns sprite sheet inside sheet rect, row by row
+    std::vector<Rectangle> splitSheet(Rectangle sheet, int rows, int columns);
+
+    /// Image to be packed and the id it is exposed by
+    struct AtlasEntry {
+        std::string id;
+        std::string path;
+    };
+
+    /// Skyline bottom-left packer for a single page
+    class SkylinePacker {
+        struct Segment {
+            int x;
+            int y;
+            int width;
+        };
+
+        std::vector<Segment> skyline_;
+        int width_;
+        int height_;
+        int usedHeight_ = 0;
+
+        /// Lowest y the rect can be placed at starting from segment, -1 if it does not fit
+        [[nodiscard]] int fitAt(size_t segment, int width, int height) const;
+    public:
+        SkylinePacker(int width, int height);
+
+        /// Returns false if rect does not fit in the page
+        bool insert(int width, int height, int &x, int &y);
+
+        [[nodiscard]] int getUsedHeight() const { return usedHeight_; }
+    };
+
+    /// Atlas packed on CPU. Pages are R8G8B8A8 images owned by the caller
+    struct PackedAtlas {
+        std::vector<Image> pages;
+        std::unordered_map<std::string, AtlasRegion> regions;
+    };
+
+    /// Decode entries and pack them into as few pages as possible. Images that failed to load are skipped
+    PackedAtlas packImages(const std::vector<AtlasEntry> &entries, int pageSize, int padding);
+
+    class TextureAtlas {
+        static std::vector<Texture2D> s_pages;
+        /// Pages loaded from cache are streamed; INVALID_STREAM for pages uploaded directly
+        static std::vector<streaming::StreamHandle> s_pageStreams;
+        /// Indexed by assets::TextureId
+        static std::array<AtlasRegion, assets::TEXTURE_COUNT> s_regions;
+
+        /// Pick manifest sprites out of regions built by id
+        static void setRegions(const std::unordered_map<std::string, AtlasRegion> &regions);
+
+        static bool loadCache(const std::vector<AtlasEntry> &entries, const std::string &cacheDir);
+        static void pack(const std::vector<AtlasEntry> &entries, const std::string &cacheDir);
+    public:
+        static constexpr int PAGE_SIZE = 2048;
+        /// Gap between packed images so filtering does not bleed neighbours in
+        static constexpr int PADDING = 2;
+
+        /// Pack entries into pages, or load them from cacheDir if sources did not change
+        static void Build(const std::vector<AtlasEntry> &entries, const std::string &cacheDir);
+
+        /// Build atlas from every sprite in asset manifest
+        static void LoadAll();
+
+        static void UnloadAll();
+
+        /// Take ownership of already uploaded pages, replacing current ones
+        static void Assign(std::vector<Texture2D> pages, std::unordered_map<std::string, AtlasRegion> regions);
+
+        /// Invalid region if sprite failed to load
+        [[nodiscard]] static AtlasRegion Get(const assets::TextureId id) { return s_regions[assets::index(id)]; }
+
+        /// Streamer placeholder while the page is loading. Resolve it at draw time, not once,
+        /// and on the window thread only: code that may run elsewhere submits the page index
+        [[nodiscard]] static Texture2D GetPageTexture(int page);
+
+        [[nodiscard]] static int GetPageCount() { return static_cast<int>(s_pages.size()); }
+    };
+}
+
+#endif //TEXTUREATLAS_H
@@ -0,0 +1,67 @@
+#ifndef TILEDBACKGROUND_H
+#define TILEDBACKGROUND_H
+
+#include <string>
+#include <vector>
+
+#include "raylib.h"
+#include "core/assetStreamer.h"
+
+namespace core::render {
+    /// Background image repeated over a world area and split into square chunks.
+    /// Every mip level is a pre-scaled copy of the image with its own chunks.
+    /// Image is decoded by AssetStreamer workers and nothing is drawn until it arrives.
+    /// Chunks are uploaded when they first become
+    /// visible and unloaded after staying off-screen for a while
+    class TiledBackground {
+        struct Tile {
+            Texture2D texture {};
+            unsigned long lastUsedFrame = 0;
+        };
+
+        struct MipLevel {
+            Image image {};
+            int tilesX = 0;
+            int tilesY = 0;
+            std::vector<Tile> tiles;
+        };
+
+        std::string path_;
+        Rectangle area_;
+        int tileSize_;
+        float parallax_;
+
+        streaming::StreamHandle sourceStream_ = streaming::INVALID_STREAM;
+        Image source_ {};
+        std::vector<MipLevel> levels_;
+        unsigned long frame_ = 0;
+        int residentTiles_ = 0;
+
+        void requestSource();
+        /// False while source image is not decoded yet
+        bool acquireSource();
+        MipLevel &getLevel(int level);
+        Texture2D getTile(MipLevel &mip, int tileX, int tileY);
+        void evictUnused();
+    public:
+        /// Tiles not drawn for this many frames are unloaded
+        static constexpr unsigned long EVICT_AFTER_FRAMES = 180;
+
+        /// parallax 1 moves with the world, 0 sticks to the camera
+        TiledBackground(std::string path, const Rectangle &area, int tileSize = 512,
+                        int mipLevels = 3, float parallax = 1.f);
+        ~TiledBackground();
+
+        TiledBackground(const TiledBackground &) = delete;
+        TiledBackground &operator=(const TiledBackground &) = delete;
+
+        /// Submit visible chunks to render queue on BACKGROUND layer
+        void draw(const Rectangle &view, float zoom);
+
+        void unload();
+
+        [[nodiscard]] int getResidentTiles() const { return residentTiles_; }
+    };
+}
+
+#endif //TILEDBACKGROUND_H
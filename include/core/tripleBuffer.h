@@ -0,0 +1,46 @@
+#ifndef TRIPLEBUFFER_H
+#define TRIPLEBUFFER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace core::concurrency {
+    /// One writer and one reader passing whole values without locks or waiting. Writer fills
+    /// its own slot and publishes it, reader takes the newest published one; values the
+    /// reader was too slow to see are overwritten. Slots are reused, so storage they own
+    /// (vectors) keeps its capacity
+    template <typename T>
+    class TripleBuffer {
+        /// Set on the middle slot index until the reader takes it
+        static constexpr uint8_t FRESH = 4;
+        static constexpr uint8_t INDEX = 3;
+
+        std::array<T, 3> slots_ {};
+        /// Slot between writer and reader, owned by neither
+        std::atomic<uint8_t> middle_ = 1;
+        uint8_t writing_ = 0;
+        uint8_t reading_ = 2;
+    public:
+        /// Writer's slot. Holds whatever was published two or more times ago
+        T &getWriteSlot() { return slots_[writing_]; }
+
+        /// Hand write slot over to the reader
+        void publish() {
+            writing_ = middle_.exchange(writing_ | FRESH, std::memory_order_acq_rel) & INDEX;
+        }
+
+        /// Take newest published value into read slot. False if nothing was published since last call
+        bool acquire() {
+            if (!(middle_.load(std::memory_order_relaxed) & FRESH))
+                return false;
+            reading_ = middle_.exchange(reading_, std::memory_order_acq_rel) & INDEX;
+            return true;
+        }
+
+        /// Value taken by last successful acquire, default constructed before the first one
+        [[nodiscard]] const T &getReadSlot() const { return slots_[reading_]; }
+    };
+}
+
+#endif //TRIPLEBUFFER_H
@@ -0,0 +1,46 @@
+#ifndef UDPSOCKET_H
+#define UDPSOCKET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace core::net {
+    /// IPv4 endpoint, both parts in host byte order
+    struct Address {
+        uint32_t host = 0;
+        uint16_t port = 0;
+
+        bool operator==(const Address &other) const = default;
+    };
+
+    /// "127.0.0.1:7777". Returns false on anything else
+    bool parseAddress(const std::string &text, Address &out);
+
+    /// Non-blocking UDP socket. Closed on destruction
+    class UdpSocket {
+        /// SOCKET on Windows, file descriptor elsewhere
+        intptr_t handle_ = -1;
+    public:
+        UdpSocket() = default;
+        UdpSocket(const UdpSocket &other) = delete;
+        UdpSocket &operator=(const UdpSocket &other) = delete;
+        ~UdpSocket() { close(); }
+
+        /// Bind to port on every interface, zero for any free port
+        bool open(uint16_t port);
+        void close();
+
+        [[nodiscard]] bool isOpen() const { return handle_ != -1; }
+        /// Port actually bound, zero if not open
+        [[nodiscard]] uint16_t getPort() const;
+
+        /// Whole datagram or nothing. False if it was not sent
+        bool send(const Address &to, const void *data, size_t size) const;
+
+        /// Next waiting datagram cut to capacity. Returns its size, or -1 if nothing is waiting
+        int receive(void *buffer, size_t capacity, Address &from) const;
+    };
+}
+
+#endif //UDPSOCKET_H
@@ -0,0 +1,89 @@
+#ifndef BOUNDARYSYSTEM_H
+#define BOUNDARYSYSTEM_H
+
+#include <cstdint>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+#include "raylib.h"
+#include "game/gameObjects.h"
+
+namespace game::world {
+    /// What happens to an object that left the world
+    enum class BoundaryPolicy {
+        /// Not tracked
+        NONE,
+        /// Velocity mirrored back inside
+        REFLECT,
+        /// Moved to the opposite side: toroidal for rect bounds, through center for circle
+        WRAP,
+        /// Destroyed
+        DESPAWN
+    };
+
+    struct WorldBounds {
+        enum Shape { NONE, CIRCLE, RECT };
+
+        Shape shape = NONE;
+        Vector2 center {0, 0};
+        float radius = 0;
+        Rectangle rect {0, 0, 0, 0};
+
+        static WorldBounds Circle(const Vector2 center, const float radius) {
+            return {CIRCLE, center, radius, {center.x - radius, center.y - radius, 2 * radius, 2 * radius}};
+        }
+        static WorldBounds Rect(const Rectangle &rect) {
+            return {RECT, {rect.x + rect.width / 2, rect.y + rect.height / 2}, 0, rect};
+        }
+    };
+
+    /// Keeps objects inside world bounds as one batched pass: positions of tracked objects
+    /// are gathered into packed arrays, tested with squared distances, and only those
+    /// outside get their policy applied. Policy is registered per concrete type and looked
+    /// up once, when object list changes, not every frame
+    class BoundarySystem {
+        struct Body {
+            game_objects::GameObject *object;
+            game_objects::MovingObject *moving;
+            game_objects::CollidingObject *colliding;
+            BoundaryPolicy policy;
+        };
+
+        static WorldBounds s_bounds;
+        static std::unordered_map<std::type_index, BoundaryPolicy> s_policies;
+
+        static std::vector<Body> s_bodies;
+        static std::vector<float> s_posX;
+        static std::vector<float> s_posY;
+        static std::vector<uint8_t> s_outside;
+        /// GameObject::s_allObjectsVersion bodies were collected at
+        static uint64_t s_bodiesVersion;
+
+        static void rebuild();
+        static void testCircle(size_t count);
+        static void testRect(size_t count);
+        static void apply(const Body &body, Vector2 position);
+        /// Outward normal of boundary nearest to position outside
+        static Vector2 outwardNormal(Vector2 position);
+    public:
+        static void SetBounds(const WorldBounds &bounds) { s_bounds = bounds; }
+        [[nodiscard]] static const WorldBounds &GetBounds() { return s_bounds; }
+
+        /// Policy for objects of exactly type T; subclasses need their own
+        template<typename T>
+        static void SetPolicy(const BoundaryPolicy policy) {
+            s_policies[std::type_index(typeid(T))] = policy;
+            s_bodiesVersion = UINT64_MAX;  // Rebuild with new policy
+        }
+
+        static void ClearPolicies();
+
+        /// Enforce bounds on every active tracked object
+        static void Update();
+
+        [[nodiscard]] static size_t GetTrackedCount() { return s_bodies.size(); }
+    };
+}
+
+#endif //BOUNDARYSYSTEM_H
@@ -0,0 +1,120 @@
+#ifndef CHUNKEDWORLD_H
+#define CHUNKEDWORLD_H
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "raylib.h"
+#include "components.h"
+#include "core/objectPool.h"
+#include "core/snapshot.h"
+
+namespace game::game_objects {
+    class Asteroid;
+}
+
+namespace game::world {
+    /// Asteroid frozen in an inactive chunk
+    struct AsteroidRecord {
+        /// Position from chunk corner, CHUNK_SIZE / 65536 per step
+        uint16_t x;
+        uint16_t y;
+        /// Units per second
+        int16_t velocityX;
+        int16_t velocityY;
+        uint8_t size;
+        uint8_t hp;
+    };
+    static_assert(sizeof(AsteroidRecord) == 10, "Record layout changed");
+
+    /// What generated asteroids look like
+    struct AsteroidParams {
+        int minSize;
+        int maxSize;
+        int hp;
+        int minSpeed;
+        int maxSpeed;
+    };
+
+    /// Open space split into square chunks. Chunks around focus point are live and their
+    /// asteroids are ordinary game objects. Others are kept as compact records or, if never
+    /// visited, not kept at all: content is generated from world seed on first activation.
+    /// Asteroid objects come from a pool, so travelling reuses them instead of allocating,
+    /// and cost depends on active area only
+    class ChunkedWorld {
+        struct Chunk {
+            std::vector<AsteroidRecord> records;
+            bool active = false;
+        };
+
+        struct ChunkCoord {
+            int x;
+            int y;
+        };
+
+        AsteroidParams params_;
+        std::unordered_map<uint64_t, Chunk> chunks_;
+        std::vector<ChunkCoord> active_;
+        std::vector<std::shared_ptr<game_objects::Asteroid>> live_;
+        core::object_pool::ObjectPool<game_objects::Asteroid> pool_;
+
+        uint32_t seed_ = 0;
+        /// Generated chunks leave this circle empty, so the player does not start inside a rock
+        Vector2 safeCenter_ {0, 0};
+        float safeRadius_ = 0;
+        size_t recordCount_ = 0;
+
+        static uint64_t keyOf(int x, int y);
+        static ChunkCoord coordOf(Vector2 position);
+        static Vector2 cornerOf(ChunkCoord coord);
+
+        /// Chunk is generated on first access
+        Chunk &getChunk(ChunkCoord coord);
+        void generate(ChunkCoord coord, std::vector<AsteroidRecord> &out) const;
+
+        void activate(ChunkCoord coord);
+        /// Pooled asteroid or a new one if pool is empty
+        std::shared_ptr<game_objects::Asteroid> acquire(const components::Transform2D &transform, int hp);
+        void spawn(ChunkCoord coord, const AsteroidRecord &record);
+        void releaseLive();
+        /// Store live asteroid into chunk it is in and return it to pool
+        void freeze(const std::shared_ptr<game_objects::Asteroid> &asteroid, ChunkCoord coord);
+    public:
+        static constexpr float CHUNK_SIZE = 1024;
+        /// Chunks this far from focus chunk are activated: 3x3 around it
+        static constexpr int ACTIVE_RADIUS = 1;
+        /// And this far are deactivated, so crossing a border back and forth does not thrash
+        static constexpr int KEEP_RADIUS = 2;
+        /// Generation grid per chunk side; at most one asteroid per cell
+        static constexpr int CELLS_PER_CHUNK = 8;
+        static constexpr int ASTEROID_CHANCE_PERCENT = 10;
+
+        explicit ChunkedWorld(const AsteroidParams &params): params_(params) {}
+
+        ChunkedWorld(const ChunkedWorld &) = delete;
+        ChunkedWorld &operator=(const ChunkedWorld &) = delete;
+
+        /// Forget all chunks and start a new world. Live asteroids go back to pool
+        void reset(uint32_t seed, Vector2 safeCenter, float safeRadius);
+
+        /// Activate chunks around focus, freeze asteroids that ended up outside active ones
+        void update(Vector2 focus);
+
+        /// Drop asteroids destroyed since last call. Returns how many there were
+        int collectDestroyed();
+
+        /// Seed, every chunk and live asteroids. Asteroid params are settings and are not saved
+        void saveState(core::snapshot::SnapshotWriter &writer) const;
+        /// Replaces whole world. Live asteroids are reused from pool where possible
+        bool loadState(core::snapshot::SnapshotReader &reader);
+
+        [[nodiscard]] size_t getActiveChunkCount() const { return active_.size(); }
+        [[nodiscard]] size_t getStoredChunkCount() const { return chunks_.size() - active_.size(); }
+        [[nodiscard]] size_t getLiveCount() const { return live_.size(); }
+        [[nodiscard]] size_t getRecordCount() const { return recordCount_; }
+    };
+}
+
+#endif //CHUNKEDWORLD_H
@@ -5,14 +5,38 @@
 #ifndef PLAYER_H
 #define PLAYER_H
 #include <raylib.h>
+#include <array>
 #include <vector>
 
 #include "components.h"
 #include "units.h"
 #include "game/gameObjects.h"
+#include "core/particleSystem.h"
 #include <memory>
 
 namespace game::game_objects {
+    /// Player as world snapshots keep it. Emitters live in the particle system's state
+    struct PlayerState {
+        components::Transform2D transform = components::Transform2DZero();
+        Vector2 velocity {0, 0};
+        Vector2 accelerationDirection {0, 0};
+        float acceleration = 0;
+        float maxSpeed = 0;
+        float angle = 0;
+        float rotationSpeed = 0;
+        float rotationAcceleration = 0;
+        std::array<Vector2, 3> verticesOffsets {};
+
+        float shootTimeOut = 0;
+        float dashTimeOut = 0;
+        float dashingTime = 0;
+        float dashInvincibilityTime = 0;
+        float damageInvincibilityTime = 0;
+        float cantControlTime = 0;
+
+        UnitState unit;
+    };
+
     class Player final : public Unit {
         float maxSpeedDashless_;
         float angle_ = 0;
@@ -31,6 +55,12 @@ namespace game::game_objects {
         float damageInvincibilityTime_ = 0;
         float cantControlTime_ = 0;
 
+        core::particles::EmitterHandle thrusterEmitter_ = core::particles::INVALID_EMITTER;
+        core::particles::EmitterHandle dashTrailEmitter_ = core::particles::INVALID_EMITTER;
+
+        void createEmitters();
+        void updateEmitters(bool thrusting);
+
         explicit Player(const components::Transform2D &tr, const int hp,
             const float maxSpeed, const float maxRotationSpeed):
         GameObject(tr), Unit(hp, maxSpeed),
@@ -42,9 +72,13 @@ namespace game::game_objects {
 
             collider = new components::ColliderPoly({0, 0}, verticesOffsets);
             collider->setCenter(tr.center);
+            setWorldLayer(core::render::PLAYER);
+            createEmitters();
         }
 
     public:
+        ~Player() override;
+
         static Player *GetInstance() {
             return s_instance;
         }
@@ -66,6 +100,8 @@ namespace game::game_objects {
         [[nodiscard]] bool isDashing() const { return dashingTime_ > 0; }
 
         [[nodiscard]] std::vector<Vector2> getVertices() const;
+        /// Nose direction in radians
+        [[nodiscard]] float getAngle() const { return angle_; }
 
         void draw() override;
 
@@ -75,9 +111,13 @@ namespace game::game_objects {
 
         void dash(Vector2 direction, float speed);
 
+        [[nodiscard]] PlayerState getState() const;
+        void setState(const PlayerState &state);
+
         void onCollided(CollidingObject *other) override;
 
-        void LoadTexture(const char* path); 
+        void LoadTexture(const char* path);
+        void SetTexture(const core::atlas::AtlasRegion& region);
     };
 }
 
@@ -5,9 +5,23 @@
 #ifndef UNITS_H
 #define UNITS_H
 #include "game/stats.h"
+#include "core/renderQueue.h"
 #include <memory>
 
 namespace game::game_objects {
+    /// Unit fields that world snapshots keep
+    struct UnitState {
+        stats::Stat hp;
+        bool dead = false;
+    };
+
+    /// Asteroid as world snapshots keep it
+    struct AsteroidState {
+        components::Transform2D transform = components::Transform2DZero();
+        Vector2 velocity {0, 0};
+        UnitState unit;
+    };
+
     class Unit : public CollidingObject, public DrawnGameObject, public MovingObject {
         stats::Stat hp_{ 0 };
         bool dead_ = false;
@@ -21,6 +35,14 @@ namespace game::game_objects {
         [[nodiscard]] bool virtual isEnemy() = 0;
 
         [[nodiscard]] bool isDead() const { return dead_; };
+        [[nodiscard]] int getHp() const { return hp_.getValue(); }
+
+        /// Bring dead or deactivated unit back with full hp
+        void revive(int hp);
+
+        [[nodiscard]] UnitState getUnitState() const { return {hp_, dead_}; }
+        /// Dead units come back inactive, live ones active
+        void setUnitState(const UnitState &state);
 
         void virtual takeDamage(int value);
 
@@ -43,6 +65,7 @@ namespace game::game_objects {
             else currentSpeed_ = Vector2Normalize(currentSpeed_) * currentSpeed;
 
             collider = new components::ColliderCircle(tr);
+            setWorldLayer(core::render::ENTITIES);
         }
 
         bool isEnemy() override { return true; }
@@ -56,11 +79,18 @@ namespace game::game_objects {
             currentSpeed_ = sp * Vector2Length(currentSpeed_);
         }
 
+        /// Reuse pooled asteroid as a fresh one
+        void respawn(const components::Transform2D &tr, int hp, Vector2 velocity);
+
+        [[nodiscard]] AsteroidState getState() const { return {transform_, currentSpeed_, getUnitState()}; }
+        void setState(const AsteroidState &state);
+
         void draw() override;
         void takeDamage(int value) override;
 
         void onCollided(CollidingObject *other) override;
         void LoadTexture(const char* path);
+        void SetTexture(const core::atlas::AtlasRegion& region);
     };
 }
 
@@ -0,0 +1,29 @@
+#ifndef GAMELOOP_H
+#define GAMELOOP_H
+
+#include "core/snapshot.h"
+
+namespace game::loop {
+    /// Fixed physics step; every frame is split into as many steps as it takes
+    constexpr float DELTA_TIME_PHYS = 1.f / 60 / 2;
+
+    /// One fixed physics step: movement, collision of overlapping pairs, then projectiles
+    void updatePhysics();
+
+    /// Everything that advances the world for one frame, without drawing:
+    /// animations, particles, physics steps and logic
+    void updateSimulation(float frameTime);
+
+    /// Frame time of the running updateSimulation. Logic reads this instead of raylib's
+    /// GetFrameTime, which belongs to the thread drawing the window
+    [[nodiscard]] float getFrameTime();
+
+    /// Delete objects marked for destroying. Call once per frame, after drawing
+    void cleanup();
+
+    /// Physics time carried over between frames
+    void saveState(core::snapshot::SnapshotWriter &writer);
+    bool loadState(core::snapshot::SnapshotReader &reader);
+}
+
+#endif //GAMELOOP_H
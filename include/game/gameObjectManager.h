@@ -17,17 +17,31 @@ namespace game::management {
         ~GameObjectManager() = default;
 
         void registerInterfaces(game_objects::GameObject* obj) {
-            if (const auto drawn = dynamic_cast<game_objects::DrawnGameObject*>(obj)) {
+            const auto drawn = dynamic_cast<game_objects::DrawnGameObject*>(obj);
+            const auto colliding = dynamic_cast<game_objects::CollidingObject*>(obj);
+            if (drawn) {
                 drawnObjects_.push_back(drawn);
             }
-            if (const auto colliding = dynamic_cast<game_objects::CollidingObject*>(obj)) {
+            if (colliding) {
                 collidingObjects_.push_back(colliding);
             }
+            if (drawn && !colliding) {
+                drawnOnlyObjects_.push_back(drawn);
+            }
+        }
+
+        /// Grow geometrically, so many small bulk creations do not reallocate every time
+        template<typename Vector>
+        static void reserveFor(Vector& vec, const size_t count) {
+            if (vec.capacity() < vec.size() + count)
+                vec.reserve(std::max(vec.size() + count, vec.capacity() * 2));
         }
 
         std::vector<std::shared_ptr<game_objects::GameObject>> ownedObjects_;
         std::vector<game_objects::DrawnGameObject*> drawnObjects_;
         std::vector<game_objects::CollidingObject*> collidingObjects_;
+        /// Drawn objects the physics broad-phase does not index, so culling tests them directly
+        std::vector<game_objects::DrawnGameObject*> drawnOnlyObjects_;
     public:
         // Singleton access
         static GameObjectManager& getInstance() {
@@ -48,6 +62,37 @@ namespace game::management {
             return obj;
         }
 
+        /// Create count objects at once: storage is reserved up front and interfaces are
+        /// known at compile time, no dynamic_cast per object. makeObject(i) returns shared_ptr<T>
+        template<typename T, typename Factory>
+        std::vector<std::shared_ptr<T>> createObjects(const size_t count, Factory&& makeObject) {
+            static_assert(std::is_base_of_v<game_objects::GameObject, T>,
+                          "T must inherit from GameObject");
+            constexpr bool isDrawn = std::is_base_of_v<game_objects::DrawnGameObject, T>;
+            constexpr bool isColliding = std::is_base_of_v<game_objects::CollidingObject, T>;
+
+            std::vector<std::shared_ptr<T>> created;
+            created.reserve(count);
+            reserveFor(ownedObjects_, count);
+            if constexpr (isDrawn) reserveFor(drawnObjects_, count);
+            if constexpr (isColliding) reserveFor(collidingObjects_, count);
+            if constexpr (isDrawn && !isColliding) reserveFor(drawnOnlyObjects_, count);
+
+            for (size_t i = 0; i < count; i++) {
+                std::shared_ptr<T> obj = makeObject(i);
+                if constexpr (isDrawn) drawnObjects_.push_back(obj.get());
+                if constexpr (isColliding) collidingObjects_.push_back(obj.get());
+                if constexpr (isDrawn && !isColliding) drawnOnlyObjects_.push_back(obj.get());
+                ownedObjects_.push_back(obj);
+                created.push_back(std::move(obj));
+            }
+
+            for (const auto& obj : created) {
+                obj->start();
+            }
+            return created;
+        }
+
         // Object registration (for externally created objects like Player)
         void registerExternalObject(game_objects::GameObject* obj) {
             registerInterfaces(obj);
@@ -66,11 +111,16 @@ namespace game::management {
             return collidingObjects_;
         }
 
+        [[nodiscard]] const std::vector<game_objects::DrawnGameObject*>& getDrawnOnlyObjects() const {
+            return drawnOnlyObjects_;
+        }
+
         // Cleanup
         void destroyAll() {
             ownedObjects_.clear(); // Automatically removes from s_allObjects via GameObject destructor
             drawnObjects_.clear();
             collidingObjects_.clear();
+            drawnOnlyObjects_.clear();
         }
 
         void destroyObjectsToDestroy() {
@@ -94,6 +144,7 @@ namespace game::management {
 
             removeFromVector(drawnObjects_);
             removeFromVector(collidingObjects_);
+            removeFromVector(drawnOnlyObjects_);
 
             // Phase 3: Finally erase owned objects (will auto-remove from s_allObjects via destructor)
             std::erase_if(ownedObjects_,
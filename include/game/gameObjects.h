@@ -4,6 +4,7 @@
 
 #ifndef GAMEOBJECTS_H
 #define GAMEOBJECTS_H
+#include <cstdint>
 #include <list>
 #include <unordered_set>
 
@@ -27,10 +28,13 @@ namespace game::game_objects {
         explicit GameObject(const components::Transform2D &tr);
     public:
         static std::list<GameObject*> s_allObjects;
+        /// Changes whenever s_allObjects does, so caches built from it know to rebuild
+        static uint64_t s_allObjectsVersion;
 
         GameObject(const GameObject& other);
         virtual ~GameObject();
 
+        [[nodiscard]] int getId() const { return id_; }
         [[nodiscard]] bool isActive() const { return isActive_; }
         [[nodiscard]] bool isToDestroy() const { return toDestroy_; }
 
@@ -108,6 +112,8 @@ namespace game::game_objects {
             return sqrt(currentSpeed_.x * currentSpeed_.x + currentSpeed_.y * currentSpeed_.y);
         }
 
+        [[nodiscard]] Vector2 getVelocity() const { return currentSpeed_; }
+
         /// Change direction of movement as if it bounced from surface with given normal
         void bounceByNormal(Vector2 normal);
 
@@ -119,6 +125,9 @@ namespace game::game_objects {
     class DrawnGameObject: public components::DrawnObject, public virtual GameObject {
     public:
         DrawnGameObject() {}
+
+        /// World-space box containing everything draw() may touch. Used for culling
+        [[nodiscard]] virtual Rectangle getDrawBounds();
     };
 } // game
 
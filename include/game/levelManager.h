@@ -6,96 +6,148 @@
 #define LEVELMANAGER_H
 
 #include "gameObjectManager.h"
+#include "chunkedWorld.h"
 #include "gameObjects.h"
 #include "texturePaths.h"
 #include "worldMap.h"
-#include "core/objectPool.h"
 #include "entities/player.h"
 #include "entities/units.h"
 #include "UI/buttonSystem.h"
+#include "core/snapshot.h"
 
 constexpr int SCREEN_WIDTH = 1040;
 constexpr int SCREEN_HEIGHT = 1040;
 constexpr float WORLD_RADIUS = 1000.f;
 constexpr Vector2 WORLD_CENTER = {SCREEN_WIDTH / 2.f, SCREEN_HEIGHT / 2.f};
+constexpr int MIN_ASTEROID_SIZE = 30;
+constexpr int MAX_ASTEROID_SIZE = 70;
+/// Asteroids never spawn closer than this to the player
+constexpr float SAFE_SPAWN_DISTANCE = 150.f;
 
 namespace game::game_objects {
     class Asteroid;
 }
 
 namespace game::management {
+    enum class WorldMode {
+        /// Fixed number of asteroids inside world circle
+        ARENA,
+        /// Unbounded space streamed in chunks around the player
+        SECTORS
+    };
+
+    /// What a level starts with. Defaults are the regular game
+    struct LevelSettings {
+        WorldMode mode = WorldMode::ARENA;
+        /// Asteroids kept alive in arena; sectors take theirs from chunks
+        int asteroidCount = 15;
+        float worldRadius = WORLD_RADIUS;
+    };
+
     class LevelManager final : public game_objects::GameObject {
 
         GameObjectManager& manager = GameObjectManager::getInstance();
+        LevelSettings settings;
         std::vector<std::shared_ptr<game_objects::Asteroid>> asteroids;
-        core::object_pool::ObjectPool<game_objects::Asteroid> asteroidPool;
         world::WorldMap worldMap;
+        world::ChunkedWorld chunkedWorld {{MIN_ASTEROID_SIZE, MAX_ASTEROID_SIZE, 10, 50, 100}};
 
         int preferredAsteroidsCount = 0;
 
         int score = 0;
 
+        /// World as startLevel left it. Restart restores this instead of building level again
+        core::snapshot::Blob levelStart;
+
+        static constexpr uint32_t RESTART_BUTTON_ID = assets::fnv1a("restart");
+        core::button::ButtonHandle restartButton = core::button::INVALID_BUTTON;
+
         void spawnAsteroids(int count);
 
         void reviveAsteroids() {
-            const int deadAsteroids = preferredAsteroidsCount - static_cast<int>(asteroids.size());
-            score += deadAsteroids;
-            spawnAsteroids(deadAsteroids);
+            spawnAsteroids(preferredAsteroidsCount - static_cast<int>(asteroids.size()));
         }
 
         void setWorldBorders() {
             manager.registerExternalObject(&worldMap);
         }
 
-        void endLevel();
-
         void win() {}
 
         void lose() {}
 
         void restart() {
-            score = 0;
-            endLevel();
-            startLevel();
+            if (!restoreSnapshot(levelStart))
+                TraceLog(LOG_WARNING, "LEVEL: Failed to restore level start");
         }
 
         void startLevel();
 
-        void cleanupAsteroidList() {
-            for (const auto& asteroid : asteroids) {
-                if (!asteroid->isDead())
-                    asteroidPool.release(asteroid);
-            }
+        void restoreAsteroids(core::snapshot::SnapshotReader &reader);
 
-            // Remove expired weak_ptrs
+        void cleanupAsteroidList() {
+            // Inactive asteroids are dead: count them and let the manager free them
             std::erase_if(asteroids,
-                          [](const std::shared_ptr<game_objects::Asteroid>& asteroid) {
-                              return !asteroid->isActive();
+                          [this](const std::shared_ptr<game_objects::Asteroid>& asteroid) {
+                              if (asteroid->isActive())
+                                  return false;
+                              score++;
+                              asteroid->destroy();
+                              return true;
                           });
         }
 
     public:
-        LevelManager() : GameObject(components::Transform2D(0, 0, 0, 0)),
-                         worldMap(WORLD_RADIUS, WORLD_CENTER) {
+        explicit LevelManager(const LevelSettings &settings) :
+        GameObject(components::Transform2D(0, 0, 0, 0)), settings(settings),
+        worldMap(settings.worldRadius, WORLD_CENTER) {
+        }
+
+        explicit LevelManager(const WorldMode mode = WorldMode::ARENA) :
+        LevelManager(LevelSettings {mode}) {
         }
 
         LevelManager(const LevelManager &other) = delete;
         LevelManager& operator=(const LevelManager &other) = delete;
 
         void logicUpdate() override {
-            cleanupAsteroidList();
-            reviveAsteroids();
+            if (settings.mode == WorldMode::SECTORS) {
+                score += chunkedWorld.collectDestroyed();
+                if (const auto player = game_objects::Player::GetInstance())
+                    chunkedWorld.update(player->getTransform().center);
+            }
+            else {
+                cleanupAsteroidList();
+                reviveAsteroids();
+            }
 
             if (const auto player = game_objects::Player::GetInstance(); player && player->isDead()) {
-                core::button::ButtonSystem::setInvisibility((std::string)"restart", false);
+                core::button::ButtonSystem::setInvisibility(restartButton, false);
             }
         }
 
         void start() override {
             startLevel();
+            saveSnapshot(levelStart);
         }
 
+        /// Copy whole simulation into blob: level, player, asteroids or chunks, projectiles,
+        /// effects and random seed. Takes time and space linear in world size and allocates
+        /// nothing once blob has grown to fit. Reseeds raylib's random generator, since its
+        /// state can't be read - that is what lets restoring replay the same future
+        void saveSnapshot(core::snapshot::Blob &blob);
+
+        /// Put world back into state blob was saved in, reusing live objects where it can.
+        /// Same level only: false for blob of another world mode or version. On false from
+        /// a damaged blob world may be partially restored
+        bool restoreSnapshot(const core::snapshot::Blob &blob);
+
         [[nodiscard]] int getScore() const { return score; }
+        [[nodiscard]] WorldMode getMode() const { return settings.mode; }
+        [[nodiscard]] size_t getAsteroidCount() const {
+            return settings.mode == WorldMode::SECTORS ? chunkedWorld.getLiveCount() : asteroids.size();
+        }
+        [[nodiscard]] const world::ChunkedWorld& getChunkedWorld() const { return chunkedWorld; }
     };
 }
 
@@ -0,0 +1,81 @@
+#ifndef NETCLIENT_H
+#define NETCLIENT_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "raylib.h"
+#include "core/udpSocket.h"
+#include "game/netProtocol.h"
+
+namespace game::net {
+    /// Entity between two received snapshots, in world units
+    struct InterpolatedEntity {
+        uint16_t id;
+        EntityKind kind;
+        Vector2 center;
+        float size;
+        /// Degrees
+        float angle;
+    };
+
+    struct ClientStats {
+        uint64_t packets = 0;
+        uint64_t bytesReceived = 0;
+        uint64_t snapshots = 0;
+        uint64_t fullSnapshots = 0;
+        /// Delta against a snapshot client no longer has, or a damaged packet
+        uint64_t undecodable = 0;
+        /// Older than newest one already decoded
+        uint64_t late = 0;
+    };
+
+    /// Thin end of a session: sends its view, decodes snapshots and draws the world a little
+    /// in the past, interpolating between the two snapshots around render time. Ticks are
+    /// the clock, so nothing depends on server and client clocks agreeing
+    class Client {
+        core::net::UdpSocket socket_;
+        core::net::Address server_;
+        /// Decoded snapshots by tick % SNAPSHOT_HISTORY: baselines and interpolation sources
+        std::array<Snapshot, SNAPSHOT_HISTORY> received_;
+        uint32_t latestTick_ = 0;
+        /// Fractional tick being shown
+        double renderTick_ = 0;
+        Rectangle view_ {0, 0, 0, 0};
+        ClientStats stats_;
+
+        void handle(const uint8_t *data, size_t size);
+        void sendReport();
+        [[nodiscard]] const Snapshot *find(uint32_t tick) const;
+    public:
+        /// Shown this far behind newest snapshot, so one or two lost ones do not stall motion
+        static constexpr double INTERPOLATION_DELAY = 4;
+        /// Render clock further off than this jumps instead of catching up smoothly
+        static constexpr double MAX_CLOCK_DRIFT = 30;
+        /// Moves longer than this between snapshots are teleports (pooled objects reused
+        /// elsewhere), not motion to smear
+        static constexpr float TELEPORT_DISTANCE = 200;
+
+        /// Opens a socket on any free port and says hello. Snapshots start once server hears it
+        bool connect(const core::net::Address &server, const Rectangle &view);
+        /// Tells server this client leaves, instead of waiting for its timeout
+        void disconnect();
+
+        /// World rect client wants entities of. Sent with next report
+        void setView(const Rectangle &view) { view_ = view; }
+
+        /// Receive everything waiting, acknowledge it and advance render clock by deltaTime seconds
+        void update(float deltaTime);
+
+        /// Entities at render time. Empty before the first snapshot
+        void interpolate(std::vector<InterpolatedEntity> &out) const;
+
+        [[nodiscard]] uint32_t getLatestTick() const { return latestTick_; }
+        [[nodiscard]] double getRenderTick() const { return renderTick_; }
+        [[nodiscard]] int getScore() const;
+        [[nodiscard]] const ClientStats &getStats() const { return stats_; }
+    };
+}
+
+#endif //NETCLIENT_H
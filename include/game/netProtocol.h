@@ -0,0 +1,144 @@
+#ifndef NETPROTOCOL_H
+#define NETPROTOCOL_H
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "raylib.h"
+#include "assetManifest.h"
+
+namespace game::net {
+    constexpr uint32_t PROTOCOL_ID = assets::fnv1a("asteroids net 1");
+    /// Below Ethernet MTU with IP and UDP headers, so datagrams are never fragmented
+    constexpr size_t MAX_PACKET_SIZE = 1400;
+    constexpr uint16_t DEFAULT_PORT = 27960;
+    constexpr double TICK_RATE = 60;
+
+    /// Snapshots each side remembers. Acks older than this make server send a full snapshot
+    constexpr uint32_t SNAPSHOT_HISTORY = 64;
+    /// Nearest ones to view center are sent when more are in view
+    constexpr size_t MAX_SNAPSHOT_ENTITIES = 64;
+    /// Positions travel in 1/8 of a world unit
+    constexpr float POSITION_SCALE = 8;
+    /// Views larger than this are cut by server, so a client can't ask for the whole world
+    constexpr float MAX_VIEW_SIZE = 4096;
+
+    enum class PacketType : uint8_t {
+        /// Client to server: newest snapshot it has and what it looks at. First one connects
+        CLIENT_REPORT,
+        DISCONNECT,
+        /// Server to client: entities in view, delta against a snapshot client acked
+        SNAPSHOT
+    };
+
+    enum class EntityKind : uint8_t {
+        ASTEROID,
+        PLAYER
+    };
+
+    /// Entity as it travels: quantized, keyed by network id
+    struct EntityState {
+        /// Server-assigned, stable for entity's lifetime. Zero is never used
+        uint16_t id = 0;
+        EntityKind kind = EntityKind::ASTEROID;
+        /// Diameter in world units
+        uint8_t size = 0;
+        int32_t x = 0;
+        int32_t y = 0;
+        /// Full turn is 65536
+        uint16_t angle = 0;
+
+        bool operator==(const EntityState &other) const = default;
+    };
+
+    /// Entities one client sees on one tick, sorted by id
+    struct Snapshot {
+        /// Zero marks an empty history slot
+        uint32_t tick = 0;
+        int32_t score = 0;
+        std::vector<EntityState> entities;
+    };
+
+    struct ClientReport {
+        /// Newest snapshot client decoded, zero if none yet
+        uint32_t ackTick = 0;
+        Rectangle view {0, 0, 0, 0};
+    };
+
+    inline int32_t quantizePosition(const float value) {
+        return static_cast<int32_t>(std::lround(value * POSITION_SCALE));
+    }
+
+    inline float dequantizePosition(const int32_t value) {
+        return static_cast<float>(value) / POSITION_SCALE;
+    }
+
+    inline uint16_t quantizeAngle(const float degrees) {
+        const float turns = degrees / 360.f;
+        return static_cast<uint16_t>(static_cast<int32_t>(std::lround((turns - std::floor(turns)) * 65536.f)));
+    }
+
+    inline float dequantizeAngle(const uint16_t angle) {
+        return static_cast<float>(angle) * 360.f / 65536.f;
+    }
+
+    /// Packet being built in a fixed buffer. Writes past the end set failed and are dropped
+    class PacketWriter {
+        std::array<uint8_t, MAX_PACKET_SIZE> data_ {};
+        size_t size_ = 0;
+        bool failed_ = false;
+    public:
+        void writeU8(uint8_t value);
+        /// Little endian
+        void writeU32(uint32_t value);
+        /// 7 bits per byte, small values take one
+        void writeVarint(uint32_t value);
+        /// Zigzag varint: small values of either sign take one byte
+        void writeSigned(int32_t value);
+
+        [[nodiscard]] const uint8_t *data() const { return data_.data(); }
+        [[nodiscard]] size_t size() const { return size_; }
+        [[nodiscard]] bool failed() const { return failed_; }
+    };
+
+    /// Reads what PacketWriter wrote. Reads past the end fail the reader and return zero
+    class PacketReader {
+        const uint8_t *data_;
+        size_t size_;
+        size_t offset_ = 0;
+        bool failed_ = false;
+    public:
+        PacketReader(const uint8_t *data, const size_t size): data_(data), size_(size) {}
+
+        uint8_t readU8();
+        uint32_t readU32();
+        uint32_t readVarint();
+        int32_t readSigned();
+
+        [[nodiscard]] bool failed() const { return failed_; }
+        [[nodiscard]] bool atEnd() const { return offset_ == size_; }
+    };
+
+    void writeHeader(PacketWriter &writer, PacketType type);
+    /// False for packets of another protocol or unknown type
+    bool readHeader(PacketReader &reader, PacketType &type);
+
+    void writeReport(PacketWriter &writer, const ClientReport &report);
+    bool readReport(PacketReader &reader, ClientReport &report);
+
+    /// Entities are written as changes from baseline's entity with the same id, or from zero
+    /// for ones baseline does not have. Entities baseline has and snapshot does not are gone.
+    /// No baseline writes a full snapshot. Header is not included
+    void writeSnapshot(PacketWriter &writer, const Snapshot &snapshot, const Snapshot *baseline);
+
+    /// Tick of baseline snapshot was written against, zero for full ones. Reads only header
+    /// fields, so receiver can look baseline up before decoding the rest
+    bool readSnapshotTicks(PacketReader &reader, uint32_t &tick, uint32_t &baselineTick);
+    /// Rest of snapshot after readSnapshotTicks, applied to baseline it named
+    bool readSnapshot(PacketReader &reader, const Snapshot *baseline, Snapshot &out);
+}
+
+#endif //NETPROTOCOL_H
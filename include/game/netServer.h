@@ -0,0 +1,101 @@
+#ifndef NETSERVER_H
+#define NETSERVER_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "core/udpSocket.h"
+#include "game/gameObjects.h"
+#include "game/netProtocol.h"
+
+namespace game::net {
+    /// What snapshots cost, summed over clients
+    struct ServerStats {
+        uint64_t snapshots = 0;
+        /// Sent without a baseline: first ones, and after client fell SNAPSHOT_HISTORY behind
+        uint64_t fullSnapshots = 0;
+        uint64_t bytesSent = 0;
+        /// View query, quantizing and encoding
+        double cpuSeconds = 0;
+        /// Socket call alone; on loopback it includes waking the receiving process
+        double sendSeconds = 0;
+
+        ServerStats &operator+=(const ServerStats &other);
+        ServerStats operator-(const ServerStats &other) const;
+    };
+
+    /// Authoritative end of a session. Every tick each client gets entities around its view,
+    /// taken from the physics broad-phase, quantized and delta compressed against the newest
+    /// snapshot it acknowledged. Clients join by sending a report and leave by disconnecting
+    /// or going silent
+    class Server {
+        struct Client {
+            core::net::Address address;
+            Rectangle view {0, 0, 0, 0};
+            uint32_t ackTick = 0;
+            double lastHeard = 0;
+            /// Sent snapshots by tick % SNAPSHOT_HISTORY, baselines for acks to come
+            std::array<Snapshot, SNAPSHOT_HISTORY> history;
+            ServerStats stats;
+        };
+
+        struct NetId {
+            uint16_t id;
+            uint32_t lastSent;
+        };
+
+        core::net::UdpSocket socket_;
+        /// Clients own large histories, so they stay put when others leave
+        std::vector<std::unique_ptr<Client>> clients_;
+        ServerStats stats_;
+
+        /// Object id -> network id. Ids nobody was sent for SNAPSHOT_HISTORY ticks are
+        /// reused: no baseline a client can still acknowledge has them by then
+        std::unordered_map<int, NetId> netIds_;
+        std::vector<uint16_t> freeIds_;
+        uint16_t nextId_ = 1;
+        /// Newest tick broadcast; acks past it were never sent and are ignored
+        uint32_t lastTick_ = 0;
+
+        std::vector<game_objects::CollidingObject*> visible_;
+
+        Client *findClient(const core::net::Address &address);
+        void handle(const uint8_t *data, size_t size, const core::net::Address &from, double now);
+        void disconnect(size_t index, const char *reason);
+
+        /// Zero if all ids are taken
+        uint16_t netIdOf(const game_objects::GameObject &object, uint32_t tick);
+        void releaseStaleIds(uint32_t tick);
+
+        void collect(const Client &client, Snapshot &snapshot, uint32_t tick);
+        void sendSnapshot(Client &client, uint32_t tick, int score);
+    public:
+        static constexpr size_t MAX_CLIENTS = 64;
+        /// Seconds without a report before client is dropped
+        static constexpr double CLIENT_TIMEOUT = 5;
+        /// Bodies taken from broad-phase per view before the nearest are picked
+        static constexpr size_t MAX_VIEW_BODIES = 1024;
+
+        Server(): visible_(MAX_VIEW_BODIES) {}
+
+        /// Zero port picks any free one
+        bool open(uint16_t port);
+        [[nodiscard]] uint16_t getPort() const { return socket_.getPort(); }
+
+        /// Handle everything clients sent since last call, drop silent ones. Seconds from any fixed point
+        void receive(double now);
+
+        /// Snapshot of this tick to every client. Call after simulation and before cleanup,
+        /// while broad-phase matches the world
+        void broadcast(uint32_t tick, int score);
+
+        [[nodiscard]] size_t getClientCount() const { return clients_.size(); }
+        /// Since server started, including clients that left
+        [[nodiscard]] const ServerStats &getStats() const { return stats_; }
+    };
+}
+
+#endif //NETSERVER_H
@@ -0,0 +1,224 @@
+#ifndef PHYSICSWORLD_H
+#define PHYSICSWORLD_H
+
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <vector>
+
+#include "raymath.h"
+#include "core/spatialGrid.h"
+#include "game/gameObjects.h"
+
+namespace game::physics {
+    struct SegmentHit {
+        game_objects::CollidingObject *object = nullptr;
+        /// Position of hit along cast segment, from 0 to 1
+        float fraction = 1;
+    };
+
+    struct RaycastHit {
+        game_objects::CollidingObject *object = nullptr;
+        Vector2 point {0, 0};
+        float distance = 0;
+    };
+
+    /// Default query filter
+    struct AcceptAll {
+        bool operator()(game_objects::CollidingObject *) const { return true; }
+    };
+
+    /// Broad-phase over colliding objects. Grid is rebuilt every step, so only pairs
+    /// sharing cells reach GJK, and queries touch only bodies near the queried area.
+    /// Queries see bodies as of last Step or Sync, skip inactive ones and write into
+    /// caller buffers - nothing is allocated per query
+    class PhysicsWorld {
+        static core::spatial::SpatialGrid s_grid;
+        /// Grid item index -> body
+        static std::vector<game_objects::CollidingObject*> s_bodies;
+        /// Box around every body, bounds nearest-neighbour search
+        static Rectangle s_extent;
+
+        static void rebuild();
+        static void resolvePairs();
+
+        /// Exact test used by overlap queries, same as for colliding pairs
+        static bool overlaps(components::Collider &shape, game_objects::CollidingObject *body);
+
+        /// Moves shape from `from` to `to` against target, leaving it at `from`
+        static bool sweep(components::Collider &shape, Vector2 from, Vector2 to,
+                          components::Collider &target, float &fraction);
+
+        template<typename Filter>
+        static size_t overlap(components::Collider &shape, const Rectangle &area,
+                              const std::span<game_objects::CollidingObject*> out, Filter &filter) {
+            size_t count = 0;
+            s_grid.query(area, [&](const uint32_t item) {
+                game_objects::CollidingObject *body = s_bodies[item];
+                if (count == out.size() || !body->isActive() || !filter(body) || !overlaps(shape, body))
+                    return;
+                out[count++] = body;
+            });
+            return count;
+        }
+    public:
+        /// About two average asteroids across
+        static constexpr float CELL_SIZE = 128;
+        /// Shape casts test contact at most this many points along the way before refining
+        static constexpr int MAX_SHAPECAST_STEPS = 64;
+        static constexpr int SHAPECAST_REFINE_STEPS = 8;
+
+        /// One fixed step: movement of every active object, then collisions of overlapping pairs
+        static void Step(float deltaTime);
+
+        /// Rebuild broad-phase from current positions without moving anything
+        static void Sync();
+
+        /// Drop body pointers. Call before objects are destroyed
+        static void Clear();
+
+        /// Bodies touching circle. Returns number written, at most out.size()
+        template<typename Filter = AcceptAll>
+        static size_t OverlapCircle(const Vector2 center, const float radius,
+                                    const std::span<game_objects::CollidingObject*> out, Filter &&filter = {}) {
+            components::ColliderCircle shape(center, radius);
+            return overlap(shape, {center.x - radius, center.y - radius, 2 * radius, 2 * radius}, out, filter);
+        }
+
+        /// Bodies touching box. Returns number written, at most out.size()
+        template<typename Filter = AcceptAll>
+        static size_t OverlapAABB(const Rectangle &area, const std::span<game_objects::CollidingObject*> out,
+                                  Filter &&filter = {}) {
+            components::ColliderRect shape(area);
+            return overlap(shape, area, out, filter);
+        }
+
+        /// Bodies whose broad-phase bounds touch box, without the exact test: for what is in
+        /// sight rather than in contact. Returns number written, at most out.size()
+        template<typename Filter = AcceptAll>
+        static size_t QueryBounds(const Rectangle &area, const std::span<game_objects::CollidingObject*> out,
+                                  Filter &&filter = {}) {
+            size_t count = 0;
+            s_grid.query(area, [&](const uint32_t item) {
+                game_objects::CollidingObject *body = s_bodies[item];
+                if (count == out.size() || !body->isActive() || !filter(body))
+                    return;
+                out[count++] = body;
+            });
+            return count;
+        }
+
+        /// Up to out.size() bodies with centers nearest to point, nearest first. Returns number written
+        template<typename Filter = AcceptAll>
+        static size_t FindNearest(const Vector2 point, const std::span<game_objects::CollidingObject*> out,
+                                  Filter &&filter = {}) {
+            if (out.empty() || s_bodies.empty()) return 0;
+
+            const auto distanceSqr = [point](game_objects::CollidingObject *body) {
+                return Vector2DistanceSqr(point, body->getTransform().center);
+            };
+
+            size_t count = 0;
+            // Grow searched square until it holds k bodies no farther than its half size
+            for (float halfSize = CELL_SIZE;; halfSize *= 2) {
+                const Rectangle area = {point.x - halfSize, point.y - halfSize, 2 * halfSize, 2 * halfSize};
+                count = 0;
+                s_grid.query(area, [&](const uint32_t item) {
+                    game_objects::CollidingObject *body = s_bodies[item];
+                    if (!body->isActive() || !filter(body)) return;
+
+                    const float distance = distanceSqr(body);
+                    size_t slot;
+                    if (count < out.size())
+                        slot = count++;
+                    else if (distance < distanceSqr(out[count - 1]))
+                        slot = count - 1;
+                    else
+                        return;
+
+                    // Insertion keeps buffer sorted; k is small
+                    for (; slot > 0 && distanceSqr(out[slot - 1]) > distance; slot--)
+                        out[slot] = out[slot - 1];
+                    out[slot] = body;
+                });
+
+                const bool coversWorld = area.x <= s_extent.x && area.y <= s_extent.y &&
+                                         area.x + area.width >= s_extent.x + s_extent.width &&
+                                         area.y + area.height >= s_extent.y + s_extent.height;
+                if (coversWorld || count == out.size() && distanceSqr(out[count - 1]) <= halfSize * halfSize)
+                    return count;
+            }
+        }
+
+        /// Finds nearest active body accepted by filter(body) that circle of given radius
+        /// touches when moved from `from` to `to`
+        template<typename Filter = AcceptAll>
+        static bool SegmentCast(const Vector2 from, const Vector2 to, const float radius,
+                                SegmentHit &hit, Filter &&filter = {}) {
+            const Rectangle area = {
+                std::min(from.x, to.x) - radius, std::min(from.y, to.y) - radius,
+                std::abs(to.x - from.x) + 2 * radius, std::abs(to.y - from.y) + 2 * radius
+            };
+
+            hit = {};
+            s_grid.query(area, [&](const uint32_t item) {
+                game_objects::CollidingObject *body = s_bodies[item];
+                float fraction;
+                if (!body->isActive() || !filter(body) ||
+                    !body->collider->intersectsSegment(from, to, radius, fraction))
+                    return;
+                if (hit.object && fraction >= hit.fraction)
+                    return;
+
+                hit = {body, fraction};
+            });
+            return hit.object != nullptr;
+        }
+
+        /// First body on ray within maxDistance. Direction need not be normalized
+        template<typename Filter = AcceptAll>
+        static bool Raycast(const Vector2 origin, const Vector2 direction, const float maxDistance,
+                            RaycastHit &hit, Filter &&filter = {}) {
+            hit = {};
+            const Vector2 to = origin + Vector2Normalize(direction) * maxDistance;
+            SegmentHit segmentHit;
+            if (!SegmentCast(origin, to, 0, segmentHit, filter))
+                return false;
+
+            hit.object = segmentHit.object;
+            hit.distance = segmentHit.fraction * maxDistance;
+            hit.point = Vector2Lerp(origin, to, segmentHit.fraction);
+            return true;
+        }
+
+        /// First body touched by shape translated (not rotated) from `from` to `to`, shape
+        /// being positioned by its center. Shape is left at `from`
+        template<typename Filter = AcceptAll>
+        static bool ShapeCast(components::Collider &shape, const Vector2 from, const Vector2 to,
+                              SegmentHit &hit, Filter &&filter = {}) {
+            shape.setCenter(from);
+            const Rectangle start = shape.getBounds();
+            const Rectangle area = {
+                std::min(start.x, start.x + to.x - from.x), std::min(start.y, start.y + to.y - from.y),
+                start.width + std::abs(to.x - from.x), start.height + std::abs(to.y - from.y)
+            };
+
+            hit = {};
+            s_grid.query(area, [&](const uint32_t item) {
+                game_objects::CollidingObject *body = s_bodies[item];
+                float fraction;
+                if (!body->isActive() || !filter(body) || !sweep(shape, from, to, *body->collider, fraction))
+                    return;
+                if (hit.object && fraction >= hit.fraction)
+                    return;
+
+                hit = {body, fraction};
+            });
+            return hit.object != nullptr;
+        }
+
+        [[nodiscard]] static size_t GetBodyCount() { return s_bodies.size(); }
+    };
+}
+
+#endif //PHYSICSWORLD_H
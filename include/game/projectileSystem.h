@@ -0,0 +1,62 @@
+#ifndef PROJECTILESYSTEM_H
+#define PROJECTILESYSTEM_H
+
+#include <vector>
+
+#include "raylib.h"
+#include "core/snapshot.h"
+
+namespace game::projectiles {
+    /// Projectiles are structure-of-arrays records instead of game objects: moving them
+    /// is a linear pass, hits are swept segments against physics broad-phase and all of
+    /// them go to render queue with one shared texture. Spawns over capacity are dropped
+    class ProjectileSystem {
+        static std::vector<float> s_posX;
+        static std::vector<float> s_posY;
+        static std::vector<float> s_velX;
+        static std::vector<float> s_velY;
+        static std::vector<float> s_life;
+        static std::vector<float> s_radius;
+        static std::vector<int> s_damage;
+        static size_t s_count;
+
+        static Vector2 s_boundsCenter;
+        static float s_boundsRadiusSqr;
+
+        /// Red disc with yellow rim, generated on Init
+        static Texture2D s_texture;
+
+        static void remove(size_t i);
+    public:
+        static constexpr size_t DEFAULT_CAPACITY = 65536;
+        static constexpr float DEFAULT_LIFETIME = 10;
+        static constexpr int TEXTURE_SIZE = 16;
+
+        static void Init(size_t capacity = DEFAULT_CAPACITY);
+        static void Shutdown();
+
+        /// Projectiles leaving this circle are removed
+        static void SetBounds(Vector2 center, float radius);
+
+        static void Spawn(Vector2 position, Vector2 velocity, float radius, int damage,
+                          float lifetime = DEFAULT_LIFETIME);
+
+        /// Move every projectile and damage first asteroid on its way.
+        /// Call right after PhysicsWorld::Step, so broad-phase matches this step
+        static void Update(float deltaTime);
+
+        /// Submit visible projectiles to render queue as one batch
+        static void Draw();
+
+        static void Clear();
+
+        /// Live projectiles. Bounds are level settings and are not saved
+        static void SaveState(core::snapshot::SnapshotWriter &writer);
+        static bool LoadState(core::snapshot::SnapshotReader &reader);
+
+        [[nodiscard]] static size_t GetCount() { return s_count; }
+        [[nodiscard]] static size_t GetCapacity() { return s_posX.size(); }
+    };
+}
+
+#endif //PROJECTILESYSTEM_H
@@ -0,0 +1,70 @@
+#ifndef SIMULATIONTHREAD_H
+#define SIMULATIONTHREAD_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#include "components.h"
+#include "core/physicsStats.h"
+#include "core/renderCulling.h"
+#include "core/renderQueue.h"
+#include "core/tripleBuffer.h"
+#include "game/levelManager.h"
+
+namespace game::simulation {
+    /// What the window thread needs to draw one simulation tick. Holds no pointers into the
+    /// world, so simulation is free to change or delete anything once it is published
+    struct RenderSnapshot {
+        /// Zero until the first tick is published
+        uint64_t tick = 0;
+        components::GameCamera camera;
+        Rectangle view {0, 0, 0, 0};
+        /// Entities, effects, projectiles and world-space buttons in draw order
+        core::render::RenderBatch world;
+        core::render::CullingStats culling;
+        int score = 0;
+        core::physics_stats::StepStats physics;
+    };
+
+    /// Runs simulation, camera and UI on a thread of its own at a fixed tick rate. Every tick
+    /// ends with recording sprites into a RenderSnapshot, so drawing the previous tick on the
+    /// window thread overlaps with simulating the next one. Input comes from core::input::Input
+    class SimulationThread {
+        std::thread thread_;
+        std::atomic<bool> stopping_ = false;
+        core::concurrency::TripleBuffer<RenderSnapshot> snapshots_;
+
+        components::GameCamera camera_;
+        std::shared_ptr<management::LevelManager> levelManager_;
+        uint64_t tick_ = 0;
+
+        void run();
+        void tick(float frameTime);
+        void simulateTick(float frameTime);
+        void record(RenderSnapshot &snapshot);
+    public:
+        static constexpr double TICK_RATE = 60;
+        /// Longer ticks are simulated as this long, so a stall does not become a burst of physics steps
+        static constexpr float MAX_FRAME_TIME = 0.25f;
+
+        SimulationThread(const components::GameCamera &camera, std::shared_ptr<management::LevelManager> levelManager);
+        ~SimulationThread();
+
+        SimulationThread(const SimulationThread &) = delete;
+        SimulationThread &operator=(const SimulationThread &) = delete;
+
+        /// From here on world belongs to the simulation thread until stop returns
+        void start();
+        void stop();
+
+        /// Newest published snapshot, window thread only. Stays valid and unchanged until next call
+        const RenderSnapshot &acquireSnapshot() {
+            snapshots_.acquire();
+            return snapshots_.getReadSlot();
+        }
+    };
+}
+
+#endif //SIMULATIONTHREAD_H
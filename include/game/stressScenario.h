@@ -0,0 +1,104 @@
+#ifndef STRESSSCENARIO_H
+#define STRESSSCENARIO_H
+
+#include <array>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "raylib.h"
+#include "core/allocationTracker.h"
+#include "game/levelManager.h"
+
+namespace game::stress {
+    /// Everything a headless run is set up with. Loaded from a small config file of
+    /// "key = value" lines, '#' starts a comment:
+    ///   name, frames, dt, seed, world (arena|sectors), world_radius, asteroids,
+    ///   fire_rate (shots per second), waypoints ("x,y x,y ..." flown in a loop), player_hp,
+    ///   input (script)
+    struct Scenario {
+        std::string name = "default";
+        unsigned long frames = 3600;
+        float deltaTime = 1.f / 60;
+        unsigned int seed = 1;
+        management::LevelSettings level;
+        /// Input script of the null backend, relative to the config file
+        std::string inputScript;
+        /// Shots per second fired along player's nose, on top of what input does
+        float fireRate = 0;
+        /// Player steers through these in a loop. Overrides movement keys of input script
+        std::vector<Vector2> waypoints;
+        /// Player's hp at start if positive. Large values keep it flying for the whole run
+        int playerHp = 0;
+    };
+
+    /// Returns false and logs the line if file is missing or has an unknown key
+    bool LoadScenario(const std::string &path, Scenario &scenario);
+
+    /// Plays scenario's scripted part: waypoint steering and extra fire. Call every frame
+    /// after the null backend applied its input script and before simulation
+    class ScenarioDriver {
+        const Scenario &scenario_;
+        size_t waypoint_ = 0;
+        float shotsDue_ = 0;
+        /// Nose angle last frame, to estimate turn rate for braking
+        float lastAngle_ = 0;
+        bool hasLastAngle_ = false;
+        bool started_ = false;
+
+        void steer(float deltaTime);
+        void fire(float deltaTime);
+    public:
+        explicit ScenarioDriver(const Scenario &scenario): scenario_(scenario) {}
+
+        void update(float deltaTime);
+    };
+
+    struct EntityCounts {
+        size_t objects = 0;
+        size_t asteroids = 0;
+        size_t projectiles = 0;
+        size_t particles = 0;
+        size_t animations = 0;
+    };
+
+    /// Collects profiler stage times, allocation counts and entity counts every frame,
+    /// written as JSON with percentiles over the whole run
+    class StressReport {
+        struct Stage {
+            std::string name;
+            /// Milliseconds, one per frame recorded
+            std::vector<float> samples;
+        };
+
+        /// Per frame, for one allocation tag
+        struct AllocationSamples {
+            std::vector<float> allocations;
+            std::vector<float> bytes;
+            uint64_t peakLiveBytes = 0;
+        };
+
+        std::vector<Stage> stages_;
+        std::unordered_map<std::string, size_t> stageIndex_;
+        /// Last one is all tags together
+        std::array<AllocationSamples, core::memory::ALLOCATION_TAG_COUNT + 1> allocations_;
+        size_t frames_ = 0;
+        EntityCounts peaks_;
+
+        void addAllocations(AllocationSamples &samples, const core::memory::AllocationStats &stats);
+    public:
+        /// Call after Profiler::EndFrame
+        void addFrame(const EntityCounts &counts);
+
+        [[nodiscard]] const EntityCounts &getPeaks() const { return peaks_; }
+
+        /// {"scenario", "frames", "stages": [{"name", "p50_ms", ...}], "allocations": [{"tag", ...}],
+        ///  "peaks": {...}, "memory": {...}}. Allocations are there if built with GAME_ALLOC_TRACKER
+        bool write(const std::string &path, const Scenario &scenario, double wallSeconds) const;
+    };
+
+    /// Peak resident set of the process in bytes, 0 where the platform does not tell
+    size_t GetPeakResidentBytes();
+}
+
+#endif //STRESSSCENARIO_H
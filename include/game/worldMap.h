@@ -3,8 +3,10 @@
 
 #include "gameObjects.h"
 #include "components.h"
+#include "core/renderQueue.h"
 
 namespace game::world {
+    /// Draws world border. Keeping objects inside is done by BoundarySystem
     class WorldMap final : public game_objects::DrawnGameObject {
         float radius;  // World boundary radius
         Vector2 center; // World center position
@@ -14,11 +16,15 @@ namespace game::world {
         WorldMap(const float radius, const Vector2 center = {0, 0}) : GameObject(
         components::Transform2D(center, {radius, radius})), radius(radius),
             center(center) {
+            setWorldLayer(core::render::WORLD);
         }
 
-        void logicUpdate() override;
         void draw() override;
 
+        Rectangle getDrawBounds() override {
+            return {center.x - radius, center.y - radius, 2 * radius, 2 * radius};
+        }
+
         // Check if position is outside world bounds
         [[nodiscard]] bool isOutOfBounds(Vector2 position) const;
 
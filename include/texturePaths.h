@@ -4,15 +4,12 @@
 
 #ifndef TEXTUREPATHS_H
 #define TEXTUREPATHS_H
-#include <string>
 
+/// Paths of files outside the asset manifest (see assetManifest.h for sprites)
 namespace textures {
-    inline std::string project_root_str(PROJECT_ROOT_PATH);
-    inline std::string playerTexture = project_root_str + "/assets/textures/spaceship.png";
-    inline std::string background = project_root_str + "/assets/textures/backgroundMain.png";
-    inline std::string playerExplosionSheet_str = project_root_str + "/assets/textures/explosion.png";
-    inline std::string asteroidExplosionSheet_str = project_root_str + "/assets/textures/asteroid-explosion-spritesheetType3.png";
-    inline std::string asteroidTexture = project_root_str + "/assets/textures/asteroid.png";
-    inline std::string restartButtonTexture = project_root_str + "/assets/textures/button1.png";
+    inline constexpr const char *background = PROJECT_ROOT_PATH "/assets/textures/backgroundMain.png";
+    inline constexpr const char *atlasCacheDir = PROJECT_ROOT_PATH "/.cache/atlas";
+    /// Written by asset_cooker; sources are used when it is missing
+    inline constexpr const char *assetPak = PROJECT_ROOT_PATH "/.cache/assets.pak";
 }
 #endif //TEXTUREPATHS_H
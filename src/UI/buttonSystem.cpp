@@ -3,69 +3,38 @@
 #include <unordered_map>
 #include <utility>
 
+#include "core/input.h"
+#include "core/renderQueue.h"
+
 namespace core::button {
-    std::unordered_map<std::string, Button> ButtonSystem::buttons;
-
-    //Button::Button(Button&& other) noexcept :
-    //    frames(std::exchange(other.frames, {})),
-    //    bounds(other.bounds),
-    //    btnState(other.btnState),
-    //    onClick(std::move(other.onClick)) {
-    //}
-
-    //// ���������� ��������� �����������
-    //Button& Button::operator=(Button&& other) noexcept {
-    //    if (this != &other) {
-    //        // ����������� ������� �������
-    //        for (const auto& frame : frames) {
-    //            UnloadTexture(frame);
-    //        }
-
-    //        // ���������� �������
-    //        frames = std::exchange(other.frames, {});
-    //        bounds = other.bounds;
-    //        btnState = other.btnState;
-    //        onClick = std::move(other.onClick);
-    //    }
-    //    return *this;
-    //}
-
-    //Button::Button(const char* texturePath,
-    //    const std::pair<int, int>& framesCount,
-    //    const Rectangle& bounds,
-    //    std::function<void()> onClick):
-    //    bounds(bounds),
-    //    onClick(std::move(onClick)) {
-
-    //    const Texture2D spriteSheet = LoadTexture(texturePath);
-
-    //    const int frameWidth = spriteSheet.width / framesCount.second;
-    //    const int frameHeight = spriteSheet.height / framesCount.first;
-
-    //    for (int i = 0; i < framesCount.first; i++) {
-    //        for (int j = 0; j < framesCount.second; j++) {
-    //            Image frameImage = LoadImageFromTexture(spriteSheet);
-    //            ImageCrop(&frameImage,
-    //                {
-    //                static_cast<float>(j * frameWidth), static_cast<float>(i * frameHeight),
-    //                    static_cast<float>(frameWidth), static_cast<float>(frameHeight)
-    //                });
-    //            frames.push_back(LoadTextureFromImage(frameImage));
-    //            UnloadImage(frameImage);
-    //        }
-    //    }
-
-    //    UnloadTexture(spriteSheet);
-    //}
-
-/*    Button::~Button() {
-        for (const auto& frame : frames) {
-            UnloadTexture(frame);
+    std::vector<Button> ButtonSystem::buttons;
+    std::unordered_map<uint32_t, ButtonHandle> ButtonSystem::buttonIds;
+    std::vector<ButtonHandle> ButtonSystem::visibleButtons;
+    std::vector<Vector2> ButtonSystem::drawOffsets;
+    bool ButtonSystem::layoutDirty = true;
+    Vector2 ButtonSystem::lastMousePosition = {-1, -1};
+    ButtonHandle ButtonSystem::hoveredButton = INVALID_BUTTON;
+
+    ButtonHandle ButtonSystem::define(const uint32_t id, Button btn) {
+        layoutDirty = true;
+
+        if (const auto it = buttonIds.find(id); it != buttonIds.end()) {
+            Button& old = buttons[it->second];
+            if (old.ownsTexture)
+                UnloadTexture(old.texture);
+            old = std::move(btn);
+            if (hoveredButton == it->second)
+                hoveredButton = INVALID_BUTTON;
+            return it->second;
         }
-    } */ 
 
+        buttons.push_back(std::move(btn));
+        const ButtonHandle handle = static_cast<int>(buttons.size()) - 1;
+        buttonIds[id] = handle;
+        return handle;
+    }
 
-    void ButtonSystem::Load(const std::string& name,
+    ButtonHandle ButtonSystem::Load(const uint32_t id,
         const char* texturePath,
         const std::pair<int, int>& framesCount,
         const Rectangle& bounds,
@@ -73,94 +42,145 @@ namespace core::button {
         bool is_Invisible) {
 
         Button btn;
+        btn.texture = LoadTexture(texturePath);
+        btn.ownsTexture = true;
+        btn.frames = atlas::splitSheet(
+            {0, 0, static_cast<float>(btn.texture.width), static_cast<float>(btn.texture.height)},
+            framesCount.first, framesCount.second);
+        btn.bounds = bounds;
+        btn.onClick = std::move(onClick);
+        btn.is_Invisible = is_Invisible;
 
-        const Texture2D spriteSheet = LoadTexture(texturePath);
-
-        const int frameWidth = spriteSheet.width / framesCount.second;
-        const int frameHeight = spriteSheet.height / framesCount.first;
-
-        for (int i = 0; i < framesCount.first; i++) {
-            for (int j = 0; j < framesCount.second; j++) {
-                Image frameImage = LoadImageFromTexture(spriteSheet);
-                ImageCrop(&frameImage,
-                    {
-                    static_cast<float>(j * frameWidth), static_cast<float>(i * frameHeight),
-                        static_cast<float>(frameWidth), static_cast<float>(frameHeight)
-                    });
-                btn.frames.push_back(LoadTextureFromImage(frameImage));
-                UnloadImage(frameImage);
-            }
-        }
+        return define(id, std::move(btn));
+    }
+
+    ButtonHandle ButtonSystem::Load(const uint32_t id,
+        const atlas::AtlasRegion& sheet,
+        const std::pair<int, int>& framesCount,
+        const Rectangle& bounds,
+        std::function<void()> onClick,
+        bool is_Invisible) {
+
+        Button btn;
+        btn.page = sheet.page;
+        btn.frames = atlas::splitSheet(sheet.rect, framesCount.first, framesCount.second);
         btn.bounds = bounds;
-        btn.onClick = onClick;
+        btn.onClick = std::move(onClick);
         btn.is_Invisible = is_Invisible;
 
-        
-        UnloadTexture(spriteSheet);
-        buttons[name] = std::move(btn);
+        return define(id, std::move(btn));
     }
 
-    void ButtonSystem::Update() {
-        Vector2 mousePoint = GetMousePosition();
-
-        for (auto& [name, button] : buttons) {
-            if (button.is_Invisible) continue;
-            button.btnState = 0; // Reset to normal
-
-            if (CheckCollisionPointRec(mousePoint, button.bounds)) {
-                if (IsMouseButtonDown(MOUSE_BUTTON_LEFT)) {
-                    button.btnState = 2; // Pressed
-                }
-                else {
-                    button.btnState = 1; // Hover
-                }
-
-                if (IsMouseButtonReleased(MOUSE_BUTTON_LEFT)) {
-                    button.onClick();
-                }
+    ButtonHandle ButtonSystem::GetHandle(const uint32_t id) {
+        if (const auto it = buttonIds.find(id); it != buttonIds.end())
+            return it->second;
+        return INVALID_BUTTON;
+    }
+
+    void ButtonSystem::rebuildLayout() {
+        visibleButtons.clear();
+        drawOffsets.clear();
+        for (ButtonHandle handle = 0; handle < static_cast<int>(buttons.size()); handle++) {
+            Button& button = buttons[handle];
+            if (button.is_Invisible) {
+                button.btnState = NORMAL;
+                continue;
             }
+            visibleButtons.push_back(handle);
+            drawOffsets.push_back({-button.bounds.width / 2, -button.bounds.height / 2});
+        }
+
+        if (hoveredButton != INVALID_BUTTON && buttons[hoveredButton].is_Invisible)
+            hoveredButton = INVALID_BUTTON;
+        layoutDirty = false;
+    }
 
+    void ButtonSystem::hitTest(const Vector2 mousePoint, const bool released) {
+        // Later buttons are drawn on top, so they get the mouse first
+        ButtonHandle hit = INVALID_BUTTON;
+        for (auto it = visibleButtons.rbegin(); it != visibleButtons.rend(); ++it) {
+            if (CheckCollisionPointRec(mousePoint, buttons[*it].bounds)) {
+                hit = *it;
+                break;
+            }
+        }
+
+        if (hoveredButton != INVALID_BUTTON && hoveredButton != hit)
+            buttons[hoveredButton].btnState = NORMAL;
+        hoveredButton = hit;
+        if (hit == INVALID_BUTTON)
+            return;
+
+        buttons[hit].btnState = input::Input::IsMouseButtonDown(MOUSE_BUTTON_LEFT) ? PRESSED : MOUSE_HOVER;
+
+        if (released) {
+            // Callback may reload this button, which replaces the function being called
+            const auto onClick = buttons[hit].onClick;
+            onClick();
         }
     }
 
+    void ButtonSystem::Update() {
+        const bool relayout = layoutDirty;
+        if (layoutDirty)
+            rebuildLayout();
+
+        const Vector2 mousePoint = input::Input::GetMousePosition();
+        const bool moved = mousePoint.x != lastMousePosition.x || mousePoint.y != lastMousePosition.y;
+        const bool pressed = input::Input::IsMouseButtonPressed(MOUSE_BUTTON_LEFT);
+        const bool released = input::Input::IsMouseButtonReleased(MOUSE_BUTTON_LEFT);
+        if (!relayout && !moved && !pressed && !released)
+            return;
+
+        lastMousePosition = mousePoint;
+        hitTest(mousePoint, released);
+    }
+
     void ButtonSystem::Draw(const components::Transform2D& relative) {
-        for (const auto& [name, button] : buttons) {
-            if (button.is_Invisible) continue;
-            const Texture2D frame = button.frames[button.btnState];
-
-            Rectangle sourceRec = {
-                0.0f,
-                0.0f,
-                (float)frame.width,
-                (float)frame.height
-            };
-            DrawTextureRec(frame, sourceRec,
-                { relative.corner().x - button.bounds.width / 2 , relative.corner().y - button.bounds.height / 2}, WHITE);
+        if (layoutDirty)
+            rebuildLayout();
+
+        const Vector2 anchor = relative.corner();
+        for (size_t i = 0; i < visibleButtons.size(); i++) {
+            const Button& button = buttons[visibleButtons[i]];
+            const Rectangle& frame = button.frames[button.btnState];
+            const Rectangle dest = { anchor.x + drawOffsets[i].x, anchor.y + drawOffsets[i].y, frame.width, frame.height };
+            if (button.page >= 0)
+                render::RenderQueue::SubmitPage(button.page, frame, dest, { 0, 0 }, 0, WHITE, render::UI);
+            else
+                render::RenderQueue::Submit(button.texture, frame, dest, { 0, 0 }, 0, WHITE, render::UI);
         }
     }
 
-    bool ButtonSystem::IsButtonPressed(const std::string& name) {
-        if (buttons.find(name) != buttons.end()) {
-            return buttons[name].btnState == 2;
-        }
-        return false;
+    bool ButtonSystem::IsButtonPressed(const ButtonHandle handle) {
+        return isValid(handle) && buttons[handle].btnState == PRESSED;
     }
 
     void ButtonSystem::UnloadAll() {
-        for (auto& [name, button] : buttons) {
-            for (const auto& frame : button.frames) {
-                UnloadTexture(frame);
-            }
+        for (auto& button : buttons) {
+            if (button.ownsTexture)
+                UnloadTexture(button.texture);
         }
 
         buttons.clear();
+        buttonIds.clear();
+        visibleButtons.clear();
+        drawOffsets.clear();
+        hoveredButton = INVALID_BUTTON;
+        layoutDirty = true;
     }
 
-    void ButtonSystem::setInvisibility(const std::string& name, bool is_Invisible) {
-        buttons[name].is_Invisible = is_Invisible;
+    void ButtonSystem::setInvisibility(const ButtonHandle handle, const bool is_Invisible) {
+        if (!isValid(handle) || buttons[handle].is_Invisible == is_Invisible)
+            return;
+        buttons[handle].is_Invisible = is_Invisible;
+        layoutDirty = true;
     }
 
-    void ButtonSystem::setBounds(const std::string& name, Rectangle bounds) {
-        buttons[name].bounds = bounds;
+    void ButtonSystem::setBounds(const ButtonHandle handle, const Rectangle bounds) {
+        if (!isValid(handle))
+            return;
+        buttons[handle].bounds = bounds;
+        layoutDirty = true;
     }
 }
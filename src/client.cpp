@@ -0,0 +1,174 @@
+// Thin client of game_server: draws interpolated snapshots, simulates nothing.
+// Usage: game_client [--server HOST:PORT] [--at X Y] [--headless] [--seconds N]
+// View follows the player unless --at pins it. --headless opens no window and prints traffic
+// every second, so many clients can run against one server for measurements
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "raylib.h"
+#include "game/levelManager.h"
+#include "game/netClient.h"
+
+namespace {
+    struct Options {
+        core::net::Address server {0x7F000001, game::net::DEFAULT_PORT};
+        bool pinned = false;
+        Vector2 at = WORLD_CENTER;
+        bool headless = false;
+        /// Zero runs until window is closed or process interrupted
+        double seconds = 0;
+    };
+
+    /// Same zoom as the game's camera
+    constexpr float c_zoom = 0.75f;
+    constexpr Vector2 c_viewSize = {SCREEN_WIDTH / c_zoom, SCREEN_HEIGHT / c_zoom};
+
+    bool parseOptions(const int argc, char **argv, Options &options) {
+        for (int i = 1; i < argc; i++) {
+            const bool hasValue = i + 1 < argc;
+            if (!std::strcmp(argv[i], "--server") && hasValue) {
+                if (!core::net::parseAddress(argv[++i], options.server))
+                    return false;
+            }
+            else if (!std::strcmp(argv[i], "--at") && i + 2 < argc) {
+                options.pinned = true;
+                options.at.x = std::strtof(argv[++i], nullptr);
+                options.at.y = std::strtof(argv[++i], nullptr);
+            }
+            else if (!std::strcmp(argv[i], "--headless"))
+                options.headless = true;
+            else if (!std::strcmp(argv[i], "--seconds") && hasValue)
+                options.seconds = std::strtod(argv[++i], nullptr);
+            else
+                return false;
+        }
+        return options.seconds >= 0;
+    }
+
+    Rectangle viewAround(const Vector2 center) {
+        return {center.x - c_viewSize.x / 2, center.y - c_viewSize.y / 2, c_viewSize.x, c_viewSize.y};
+    }
+
+    /// Where the view goes next: pinned spot, or the player if it is in sight
+    Vector2 viewCenter(const Options &options, const std::vector<game::net::InterpolatedEntity> &entities,
+                       const Vector2 current) {
+        if (options.pinned)
+            return options.at;
+        for (const auto &entity : entities) {
+            if (entity.kind == game::net::EntityKind::PLAYER)
+                return entity.center;
+        }
+        return current;
+    }
+
+    void drawEntity(const game::net::InterpolatedEntity &entity) {
+        const float radius = entity.size / 2;
+        if (entity.kind == game::net::EntityKind::PLAYER) {
+            const float angle = entity.angle * DEG2RAD;
+            const Vector2 nose = {entity.center.x + std::cos(angle) * radius, entity.center.y + std::sin(angle) * radius};
+            const Vector2 left = {entity.center.x + std::cos(angle + 2.5f) * radius,
+                                  entity.center.y + std::sin(angle + 2.5f) * radius};
+            const Vector2 right = {entity.center.x + std::cos(angle - 2.5f) * radius,
+                                   entity.center.y + std::sin(angle - 2.5f) * radius};
+            DrawTriangle(nose, right, left, SKYBLUE);
+            return;
+        }
+        DrawCircleV(entity.center, radius, BROWN);
+        DrawCircleLines(static_cast<int>(entity.center.x), static_cast<int>(entity.center.y), radius, DARKBROWN);
+    }
+
+    void printStats(const game::net::ClientStats &stats, const game::net::ClientStats &previous,
+                    const double seconds, const game::net::Client &client, const size_t entities) {
+        std::printf("tick %u (showing %.1f) | in %.1f KB/s, %.0f snapshots/s, %llu full, %llu undecodable, %llu late | "
+                    "%zu entities\n",
+                    client.getLatestTick(), client.getRenderTick(),
+                    static_cast<double>(stats.bytesReceived - previous.bytesReceived) / 1024 / seconds,
+                    static_cast<double>(stats.snapshots - previous.snapshots) / seconds,
+                    static_cast<unsigned long long>(stats.fullSnapshots - previous.fullSnapshots),
+                    static_cast<unsigned long long>(stats.undecodable - previous.undecodable),
+                    static_cast<unsigned long long>(stats.late - previous.late), entities);
+        std::fflush(stdout);
+    }
+}
+
+int main(const int argc, char **argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        std::fprintf(stderr, "Usage: %s [--server HOST:PORT] [--at X Y] [--headless] [--seconds N]\n", argv[0]);
+        return 1;
+    }
+
+    Vector2 center = options.at;
+    game::net::Client client;
+    if (!client.connect(options.server, viewAround(center))) {
+        std::fprintf(stderr, "Failed to open UDP socket\n");
+        return 1;
+    }
+
+    if (!options.headless) {
+        InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "client");
+        SetTargetFPS(60);
+    }
+
+    using Clock = std::chrono::steady_clock;
+    const auto start = Clock::now();
+    auto lastFrame = start;
+    auto lastReport = start;
+    game::net::ClientStats reported;
+    std::vector<game::net::InterpolatedEntity> entities;
+
+    while (options.headless || !WindowShouldClose()) {
+        const auto now = Clock::now();
+        if (options.seconds > 0 && std::chrono::duration<double>(now - start).count() >= options.seconds)
+            break;
+        const float deltaTime = std::chrono::duration<float>(now - lastFrame).count();
+        lastFrame = now;
+
+        client.update(deltaTime);
+        client.interpolate(entities);
+        center = viewCenter(options, entities, center);
+        client.setView(viewAround(center));
+
+        if (options.headless) {
+            if (now - lastReport >= std::chrono::seconds(1)) {
+                printStats(client.getStats(), reported, std::chrono::duration<double>(now - lastReport).count(),
+                           client, entities.size());
+                reported = client.getStats();
+                lastReport = now;
+            }
+            std::this_thread::sleep_for(std::chrono::duration<double>(1 / game::net::TICK_RATE));
+            continue;
+        }
+
+        BeginDrawing();
+        ClearBackground(BLACK);
+
+        const Camera2D camera {{SCREEN_WIDTH / 2.f, SCREEN_HEIGHT / 2.f}, center, 0, c_zoom};
+        BeginMode2D(camera);
+        for (const auto &entity : entities)
+            drawEntity(entity);
+        EndMode2D();
+
+        const game::net::ClientStats &stats = client.getStats();
+        DrawFPS(10, 10);
+        DrawText(TextFormat("Score: %d", client.getScore()), 10, 40, 20, RED);
+        DrawText(TextFormat("Tick %u, showing %.1f, %zu entities", client.getLatestTick(), client.getRenderTick(),
+                            entities.size()), 10, 70, 20, LIGHTGRAY);
+        DrawText(TextFormat("Received %.1f KB in %llu snapshots (%llu full)",
+                            static_cast<double>(stats.bytesReceived) / 1024,
+                            static_cast<unsigned long long>(stats.snapshots),
+                            static_cast<unsigned long long>(stats.fullSnapshots)), 10, 100, 20, LIGHTGRAY);
+        EndDrawing();
+    }
+
+    client.disconnect();
+    if (!options.headless)
+        CloseWindow();
+    return 0;
+}
@@ -9,6 +9,9 @@
 #include <ostream>
 #include <stdexcept>
 
+#include "core/physicsStats.h"
+#include "core/renderQueue.h"
+
 namespace components {
     Transform2D::Transform2D(const float x, const float y, const float width,
                              const float height, const float angle):
@@ -20,8 +23,8 @@ namespace components {
 #pragma region Collider math
 
     // Helper function to check if the simplex contains the origin
-    bool containsOrigin(std::vector<Vector2>& simplex, Vector2& direction) {
-        if (simplex.size() == 2) {
+    bool containsOrigin(Simplex& simplex, Vector2& direction) {
+        if (simplex.size == 2) {
             // Line segment case
             const Vector2 a = simplex[1];
             const Vector2 b = simplex[0];
@@ -34,7 +37,7 @@ namespace components {
                 direction = Vector2{ab.y, -ab.x};
             }
             return false;
-        } else if (simplex.size() == 3) {
+        } else if (simplex.size == 3) {
             // Triangle case
             const Vector2 a = simplex[2];
             const Vector2 b = simplex[1];
@@ -43,19 +46,22 @@ namespace components {
             const Vector2 ac = c - a;
             const Vector2 ao = Vector2Negate(a);
 
-            // Check which edge is closest to the origin
+            // Edge normals pointing out of the triangle. Simplex winding is arbitrary,
+            // so each is flipped away from the third vertex
             auto abPerp = Vector2{-ab.y, ab.x};
+            if (Vector2DotProduct(abPerp, ac) > 0) abPerp = Vector2Negate(abPerp);
             auto acPerp = Vector2{ac.y, -ac.x};
+            if (Vector2DotProduct(acPerp, ab) > 0) acPerp = Vector2Negate(acPerp);
 
             if (Vector2DotProduct(abPerp, ao) > 0) {
                 // Origin is outside edge AB
-                simplex.erase(simplex.begin()); // Remove point C
+                simplex.erase(0); // Remove point C
                 direction = abPerp;
                 return false;
             }
             if (Vector2DotProduct(acPerp, ao) > 0) {
                 // Origin is outside edge AC
-                simplex.erase(simplex.begin() + 1); // Remove point B
+                simplex.erase(1); // Remove point B
                 direction = acPerp;
                 return false;
             }
@@ -65,9 +71,11 @@ namespace components {
         return false;
     }
 
-    bool Collider::checkCollision(Collider &other, std::vector<Vector2>& simplex) {
-        if (!CheckCollisionRecs(getCoveringBox(), other.getCoveringBox()))
+    bool Collider::checkCollision(Collider &other, Simplex& simplex) {
+        if (!CheckCollisionRecs(getCoveringBox(), other.getCoveringBox())) {
+            PHYSICS_COUNT(stats.aabbRejects++);
             return false;
+        }
 
         // Initial direction
         Vector2 direction = {1, 0};
@@ -77,7 +85,7 @@ namespace components {
                                     Vector2Negate(direction));
 
         // Simplex (initially contains one point)
-        simplex.push_back(support);
+        simplex.push(support);
 
         // New search direction
         direction = Vector2Negate(support);
@@ -90,26 +98,32 @@ namespace components {
 
             // If the new support point does not go past the origin, no collision
             if (Vector2DotProduct(newSupport, direction) < 0) {
+                PHYSICS_COUNT(stats.gjkIterations.add(i + 1));
                 return false;
             }
 
             // Add the new support point to the simplex
-            simplex.push_back(newSupport);
+            simplex.push(newSupport);
 
             // Check if the simplex contains the origin
             if (containsOrigin(simplex, direction)) {
+                PHYSICS_COUNT(stats.gjkIterations.add(i + 1));
                 return true;
             }
         }
 
+        PHYSICS_COUNT(stats.gjkIterations.add(1000));
         return false;
     }
 
     bool Collider::checkCollision(Collider &other) {
-        if (CheckCollisionRecs(getInnerBox(), other.getInnerBox()))
+        PHYSICS_COUNT(stats.narrowPhaseTests++);
+        if (CheckCollisionRecs(getInnerBox(), other.getInnerBox())) {
+            PHYSICS_COUNT(stats.innerBoxAccepts++);
             return true;
+        }
 
-        std::vector<Vector2> simplex;
+        Simplex simplex;
         return checkCollision(other, simplex);
     }
 
@@ -130,8 +144,13 @@ namespace components {
             Vector2 b = polytope[j];
 
             const Vector2 edge = b - a;
-            const Vector2 normal = Vector2Normalize(Vector2{-edge.y, edge.x});
-            const float distance = Vector2DotProduct(normal, a);
+            Vector2 normal = Vector2Normalize(Vector2{-edge.y, edge.x});
+            float distance = Vector2DotProduct(normal, a);
+            // Polytope contains origin, so outward normals are the ones facing away from it
+            if (distance < 0) {
+                normal = Vector2Negate(normal);
+                distance = -distance;
+            }
 
             if (distance < closestFace.distance) {
                 closestFace.distance = distance;
@@ -143,13 +162,20 @@ namespace components {
         return closestFace;
     }
 
-    Vector2 EPA(Collider& colliderA, Collider& colliderB, const std::vector<Vector2>& simplex) {
-        std::vector<Vector2> polytope = simplex;
+    Vector2 EPA(Collider& colliderA, Collider& colliderB, const Simplex& simplex) {
+        std::vector<Vector2> polytope(simplex.points, simplex.points + simplex.size);
         constexpr float tolerance = 0.0001f;
+        // Far from world origin support points carry more float error than tolerance,
+        // so curved shapes may never converge. Best face so far is close enough by then
+        constexpr int maxIterations = 32;
 
-        while (true) {
+        for (int i = 0;; i++) {
             // Find the closest face to the origin
             const Face face = getClosestFace(polytope);
+            if (i == maxIterations) {
+                PHYSICS_COUNT(stats.epaIterations.add(i));
+                return face.normal;
+            }
 
             // Get the support point in the direction of the face's normal
             Vector2 support = colliderA.supportPoint(face.normal) - colliderB.
@@ -159,6 +185,7 @@ namespace components {
             float distance = Vector2DotProduct(support, face.normal);
             if (distance - face.distance < tolerance) {
                 // The closest face is the collision normal
+                PHYSICS_COUNT(stats.epaIterations.add(i + 1));
                 return face.normal;
             }
 
@@ -169,7 +196,7 @@ namespace components {
 
     Vector2 Collider::getCollisionNormal(Collider &other) {
         // Run GJK to get the initial simplex
-        std::vector<Vector2> simplex;
+        Simplex simplex;
         if (!checkCollision(other, simplex)) {
             return {0, 0}; // No collision
         }
@@ -178,12 +205,42 @@ namespace components {
         return EPA(*this, other, simplex);
     }
 
+    bool Collider::intersectsSegment(const Vector2 from, const Vector2 to, const float radius, float &fraction) {
+        // Slab test against covering box grown by radius
+        const Rectangle box = getCoveringBox();
+        const float minBound[2] = {box.x - radius, box.y - radius};
+        const float maxBound[2] = {box.x + box.width + radius, box.y + box.height + radius};
+        const float start[2] = {from.x, from.y};
+        const float delta[2] = {to.x - from.x, to.y - from.y};
+
+        float tMin = 0, tMax = 1;
+        for (int axis = 0; axis < 2; axis++) {
+            if (fabsf(delta[axis]) < std::numeric_limits<float>::epsilon()) {
+                if (start[axis] < minBound[axis] || start[axis] > maxBound[axis])
+                    return false;
+                continue;
+            }
+
+            const float inverse = 1.f / delta[axis];
+            float t0 = (minBound[axis] - start[axis]) * inverse;
+            float t1 = (maxBound[axis] - start[axis]) * inverse;
+            if (t0 > t1) std::swap(t0, t1);
+            tMin = std::max(tMin, t0);
+            tMax = std::min(tMax, t1);
+            if (tMin > tMax)
+                return false;
+        }
+
+        fraction = tMin;
+        return true;
+    }
+
 #pragma endregion
 
 #pragma region ColliderRect
     void ColliderRect::setCenter(const Vector2 center) {
-        rect.x = center.x + rect.width / 2;
-        rect.y = center.y + rect.height / 2;
+        rect.x = center.x - rect.width / 2;
+        rect.y = center.y - rect.height / 2;
     }
 
     Vector2 ColliderRect::supportPoint(const Vector2 direction) {
@@ -251,6 +308,33 @@ namespace components {
                          sqrt2 * radius_, sqrt2 * radius_);
     }
 
+    bool ColliderCircle::intersectsSegment(const Vector2 from, const Vector2 to, const float radius,
+                                           float &fraction) {
+        // Segment against circle grown by radius: |from + t * delta - center| = r
+        const Vector2 delta = to - from;
+        const Vector2 offset = from - center_;
+        const float sumRadius = radius_ + radius;
+
+        const float c = Vector2DotProduct(offset, offset) - sumRadius * sumRadius;
+        if (c <= 0) {
+            fraction = 0;  // Starts inside
+            return true;
+        }
+
+        const float a = Vector2DotProduct(delta, delta);
+        const float b = Vector2DotProduct(offset, delta);
+        const float discriminant = b * b - a * c;
+        if (a <= 0 || b >= 0 || discriminant < 0)
+            return false;
+
+        const float t = (-b - sqrtf(discriminant)) / a;
+        if (t > 1)
+            return false;
+
+        fraction = t;
+        return true;
+    }
+
     void ColliderCircle::rotate(float angle) {
         // No need. Leave as pure virtual or not?
     }
@@ -260,7 +344,8 @@ namespace components {
     Vector2 ColliderPoly::supportPoint(Vector2 direction) {
         float maxDot = -INFINITY;
         Vector2 farthestPoint {0, 0};
-        for (const auto& point : getVertices()) {
+        for (const auto& offset : offsets_) {
+            const Vector2 point = center_ + offset;
             if (const float dot = Vector2DotProduct(point, direction);
                 dot > maxDot) {
                 maxDot = dot;
@@ -273,7 +358,8 @@ namespace components {
     Rectangle ColliderPoly::getCoveringBox() {
         float xMin = INFINITY, yMin = INFINITY, xMax = -INFINITY, yMax = -INFINITY;
 
-        for (const auto&[x, y] : getVertices()) {
+        for (const auto& offset : offsets_) {
+            const auto [x, y] = center_ + offset;
             xMax = std::max(xMax, x);
             xMin = std::min(xMin, x);
             yMax = std::max(yMax, y);
@@ -284,7 +370,7 @@ namespace components {
     }
 
     Rectangle ColliderPoly::getInnerBox() {
-        if (getVertices().empty()) {
+        if (offsets_.empty()) {
             return Rectangle{0, 0, 0, 0};
         }
 
@@ -335,11 +421,15 @@ namespace components {
         sourceRect = { 0, 0, (float)texture.width, (float)texture.height };
     }
 
+    TextureComponent::TextureComponent(const core::atlas::AtlasRegion& region, const Color tint) :
+        texture(), tint(tint), sourceRect(region.rect), region(region) {}
+
     TextureComponent::~TextureComponent() {
-        UnloadTexture(texture);
+        if (!region.isValid())
+            UnloadTexture(texture);
     }
 
-    void TextureComponent::Draw(const Transform2D& transform) const {
+    void TextureComponent::Draw(const Transform2D& transform, const int layer) const {
         Rectangle dest = {
             transform.center.x,
             transform.center.y,
@@ -347,10 +437,10 @@ namespace components {
             transform.scaledSize().y
         };
         Vector2 origin = { transform.scaledSize().x / 2, transform.scaledSize().y / 2 };
-        DrawTexturePro(texture, sourceRect, dest, origin, transform.angle, tint);
+        submit(dest, origin, transform.angle, layer);
     }
 
-    void TextureComponent::Draw(const Transform2D& transform, float angle) const {
+    void TextureComponent::Draw(const Transform2D& transform, float angle, const int layer) const {
         Rectangle dest = {
             transform.center.x,
             transform.center.y,
@@ -358,10 +448,13 @@ namespace components {
             transform.scaledSize().y
         };
         Vector2 origin = { transform.scaledSize().x / 2, transform.scaledSize().y / 2 };
-        DrawTexturePro(texture, sourceRect, dest, origin, angle + 90, tint);
+        submit(dest, origin, angle + 90, layer);
     }
 
-    Texture2D TextureComponent::getTexture() const {
-        return texture;
+    void TextureComponent::submit(const Rectangle& dest, const Vector2 origin, const float rotation, const int layer) const {
+        if (region.isValid())
+            core::render::RenderQueue::SubmitPage(region.page, sourceRect, dest, origin, rotation, tint, layer);
+        else
+            core::render::RenderQueue::Submit(texture, sourceRect, dest, origin, rotation, tint, layer);
     }
 }
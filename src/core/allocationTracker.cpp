@@ -0,0 +1,182 @@
+#include "core/allocationTracker.h"
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "raylib.h"
+
+namespace core::memory {
+    namespace {
+        constexpr const char *TAG_NAMES[] = {"other", "physics", "logic", "effects", "render", "ui", "assets"};
+        static_assert(std::size(TAG_NAMES) == ALLOCATION_TAG_COUNT);
+
+        /// Updated from any thread. Never reset: frames are differences between snapshots
+        struct alignas(64) Counters {
+            std::atomic<uint64_t> allocations = 0;
+            std::atomic<uint64_t> frees = 0;
+            std::atomic<uint64_t> bytes = 0;
+            std::atomic<uint64_t> liveBytes = 0;
+            std::atomic<uint64_t> framePeakLiveBytes = 0;
+        };
+
+        std::array<Counters, ALLOCATION_TAG_COUNT> s_counters;
+        /// Counters at BeginFrame
+        std::array<AllocationStats, ALLOCATION_TAG_COUNT> s_frameStart;
+        std::array<AllocationStats, ALLOCATION_TAG_COUNT> s_lastFrame;
+
+        thread_local AllocationTag t_tag = AllocationTag::UNTAGGED;
+
+#ifdef GAME_ALLOC_TRACKER
+        /// Written before every block. Its size keeps blocks aligned as malloc's are
+        struct alignas(alignof(std::max_align_t)) Header {
+            size_t size;
+            AllocationTag tag;
+        };
+
+        void *allocate(const size_t size) {
+            auto *header = static_cast<Header *>(std::malloc(sizeof(Header) + size));
+            if (header == nullptr)
+                return nullptr;
+
+            header->size = size;
+            header->tag = t_tag;
+            Counters &counters = s_counters[static_cast<size_t>(t_tag)];
+            counters.allocations.fetch_add(1, std::memory_order_relaxed);
+            counters.bytes.fetch_add(size, std::memory_order_relaxed);
+            const uint64_t live = counters.liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+            uint64_t peak = counters.framePeakLiveBytes.load(std::memory_order_relaxed);
+            while (live > peak && !counters.framePeakLiveBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+            return header + 1;
+        }
+
+        void release(void *block) {
+            if (block == nullptr)
+                return;
+
+            Header *header = static_cast<Header *>(block) - 1;
+            Counters &counters = s_counters[static_cast<size_t>(header->tag)];
+            counters.frees.fetch_add(1, std::memory_order_relaxed);
+            counters.liveBytes.fetch_sub(header->size, std::memory_order_relaxed);
+            std::free(header);
+        }
+
+        void *allocateOrThrow(const size_t size) {
+            void *block = allocate(size);
+            if (block == nullptr)
+                throw std::bad_alloc();
+            return block;
+        }
+#endif
+
+        AllocationStats snapshot(const Counters &counters) {
+            return {
+                counters.allocations.load(std::memory_order_relaxed),
+                counters.frees.load(std::memory_order_relaxed),
+                counters.bytes.load(std::memory_order_relaxed),
+                counters.liveBytes.load(std::memory_order_relaxed),
+                counters.framePeakLiveBytes.load(std::memory_order_relaxed)
+            };
+        }
+    }
+
+    const char *tagName(const AllocationTag tag) {
+        return TAG_NAMES[static_cast<size_t>(tag)];
+    }
+
+    AllocationScope::AllocationScope(const AllocationTag tag): previous_(t_tag) {
+        t_tag = tag;
+    }
+
+    AllocationScope::~AllocationScope() {
+        t_tag = previous_;
+    }
+
+    void AllocationTracker::BeginFrame() {
+        for (size_t i = 0; i < ALLOCATION_TAG_COUNT; i++) {
+            Counters &counters = s_counters[i];
+            counters.framePeakLiveBytes.store(counters.liveBytes.load(std::memory_order_relaxed),
+                                              std::memory_order_relaxed);
+            s_frameStart[i] = snapshot(counters);
+        }
+    }
+
+    void AllocationTracker::EndFrame() {
+        for (size_t i = 0; i < ALLOCATION_TAG_COUNT; i++) {
+            const AllocationStats now = snapshot(s_counters[i]);
+            const AllocationStats &start = s_frameStart[i];
+            s_lastFrame[i] = {
+                now.allocations - start.allocations,
+                now.frees - start.frees,
+                now.bytes - start.bytes,
+                now.liveBytes,
+                now.peakLiveBytes
+            };
+        }
+    }
+
+    const AllocationStats &AllocationTracker::GetLastFrame(const AllocationTag tag) {
+        return s_lastFrame[static_cast<size_t>(tag)];
+    }
+
+    AllocationStats AllocationTracker::GetLastFrameTotal() {
+        AllocationStats total;
+        for (const auto &stats : s_lastFrame) {
+            total.allocations += stats.allocations;
+            total.frees += stats.frees;
+            total.bytes += stats.bytes;
+            total.liveBytes += stats.liveBytes;
+            // Tags peak at different moments, so this is an upper bound
+            total.peakLiveBytes += stats.peakLiveBytes;
+        }
+        return total;
+    }
+
+    int AllocationTracker::DrawOverlay(const int x, const int y) {
+        if (!ENABLED) return 0;
+
+        constexpr int fontSize = 10;
+        constexpr int lineHeight = 12;
+        constexpr int columns[] = {0, 60, 110, 160, 235};
+        const int height = static_cast<int>(ALLOCATION_TAG_COUNT + 1) * lineHeight + 8;
+        DrawRectangle(x, y, 310, height, Fade(BLACK, 0.7f));
+
+        const char *header[] = {"alloc tag", "new", "delete", "bytes", "live / peak KB"};
+        for (int column = 0; column < 5; column++)
+            DrawText(header[column], x + 4 + columns[column], y + 4, fontSize, YELLOW);
+
+        int lineY = y + 4 + lineHeight;
+        for (size_t i = 0; i < ALLOCATION_TAG_COUNT; i++) {
+            const AllocationStats &stats = s_lastFrame[i];
+            // Anything allocating every frame is what this is looking for
+            const Color color = stats.allocations > 0 ? ORANGE : RAYWHITE;
+            DrawText(TAG_NAMES[i], x + 4, lineY, fontSize, color);
+            DrawText(TextFormat("%llu", static_cast<unsigned long long>(stats.allocations)),
+                     x + 4 + columns[1], lineY, fontSize, color);
+            DrawText(TextFormat("%llu", static_cast<unsigned long long>(stats.frees)),
+                     x + 4 + columns[2], lineY, fontSize, color);
+            DrawText(TextFormat("%llu", static_cast<unsigned long long>(stats.bytes)),
+                     x + 4 + columns[3], lineY, fontSize, color);
+            DrawText(TextFormat("%.0f / %.0f", static_cast<double>(stats.liveBytes) / 1024,
+                                static_cast<double>(stats.peakLiveBytes) / 1024),
+                     x + 4 + columns[4], lineY, fontSize, color);
+            lineY += lineHeight;
+        }
+        return height;
+    }
+}
+
+#ifdef GAME_ALLOC_TRACKER
+// Replaceable global operators. Over-aligned ones are left to the runtime and not counted
+void *operator new(const size_t size) { return core::memory::allocateOrThrow(size); }
+void *operator new[](const size_t size) { return core::memory::allocateOrThrow(size); }
+void *operator new(const size_t size, const std::nothrow_t &) noexcept { return core::memory::allocate(size); }
+void *operator new[](const size_t size, const std::nothrow_t &) noexcept { return core::memory::allocate(size); }
+void operator delete(void *block) noexcept { core::memory::release(block); }
+void operator delete[](void *block) noexcept { core::memory::release(block); }
+void operator delete(void *block, size_t) noexcept { core::memory::release(block); }
+void operator delete[](void *block, size_t) noexcept { core::memory::release(block); }
+void operator delete(void *block, const std::nothrow_t &) noexcept { core::memory::release(block); }
+void operator delete[](void *block, const std::nothrow_t &) noexcept { core::memory::release(block); }
+#endif
@@ -1,148 +1,175 @@
 #include "core/animation.h"
 #include <algorithm>
-#include "texturePaths.h"
+#include "core/renderQueue.h"
+#include "core/renderCulling.h"
+#include "core/assetPak.h"
 
 
 namespace core::animation {
-    std::unordered_map<std::string, Animation> AnimationSystem::animations;
-    std::vector<std::pair<std::string, components::Transform2D>> AnimationSystem::activeAnimations;
+    std::array<Animation, assets::ANIMATION_COUNT> AnimationSystem::animations;
+    std::vector<AnimationInstance> AnimationSystem::activeAnimations;
+
+    void AnimationSystem::define(const assets::AnimationId id, Animation anim) {
+        Animation& old = animations[assets::index(id)];
+        if (old.ownsTexture)
+            UnloadTexture(old.texture);
+        old = std::move(anim);
+    }
 
-    void AnimationSystem::Load(const std::string& name,
+    void AnimationSystem::Load(const assets::AnimationId id,
         const char* spriteSheetPath,
         const std::pair<int, int> &framesCount,
         const float frameDuration,
         const bool looping) {
 
-        const Texture2D spriteSheet = LoadTexture(spriteSheetPath);
-
-        const int frameWidth = spriteSheet.width / framesCount.second;
-        const int frameHeight = spriteSheet.height / framesCount.first;
-
         Animation anim;
+        anim.texture = LoadTexture(spriteSheetPath);
+        anim.ownsTexture = true;
         anim.frameDuration = frameDuration;
         anim.looping = looping;
+        anim.frames = atlas::splitSheet(
+            {0, 0, static_cast<float>(anim.texture.width), static_cast<float>(anim.texture.height)},
+            framesCount.first, framesCount.second);
 
+        define(id, std::move(anim));
+    }
 
-        // Extract frames from sprite sheet
-        for (int i = 0; i < framesCount.first; i++) {
-            for (int j = 0; j < framesCount.second; j++) {
-                Image frameImage = LoadImageFromTexture(spriteSheet);
-                ImageCrop(&frameImage,
-                    {
-                    static_cast<float>(j * frameWidth), static_cast<float>(i * frameHeight),
-                        static_cast<float>(frameWidth), static_cast<float>(frameHeight)
-                    });
-                anim.frames.push_back(LoadTextureFromImage(frameImage));
-                UnloadImage(frameImage);
-            }
-        }
+    void AnimationSystem::Load(const assets::AnimationId id,
+        const atlas::AtlasRegion& spriteSheet,
+        const std::pair<int, int> &framesCount,
+        const float frameDuration,
+        const bool looping) {
 
-        UnloadTexture(spriteSheet);
-        animations[name] = anim;
+        Animation anim;
+        anim.page = spriteSheet.page;
+        anim.frameDuration = frameDuration;
+        anim.looping = looping;
+        anim.frames = atlas::splitSheet(spriteSheet.rect, framesCount.first, framesCount.second);
+
+        define(id, std::move(anim));
     }
 
-    void AnimationSystem::Play(const std::string& name, components::Transform2D transform) {
-        if (animations.contains(name)) {
-            animations[name].currentFrame = 0;
-            animations[name].frameTime = 0;
-            activeAnimations.emplace_back(name, transform);
-        }
+    void AnimationSystem::Play(const assets::AnimationId id, const components::Transform2D &transform) {
+        if (animations[assets::index(id)].frames.empty())
+            return;
+
+        activeAnimations.push_back({id, 0, 0, transform});
     }
 
-    void AnimationSystem::SetFlip(const std::string& name, const bool flipX, const bool flipY) {
-        if (animations.contains(name)) {
-            animations[name].flipX = flipX;
-            animations[name].flipY = flipY;
-        }
+    void AnimationSystem::SetFlip(const assets::AnimationId id, const bool flipX, const bool flipY) {
+        animations[assets::index(id)].flipX = flipX;
+        animations[assets::index(id)].flipY = flipY;
     }
 
     void AnimationSystem::Update(const float deltaTime) {
-        // Update animation frames
-        for (auto& [name, anim] : animations) {
-            if (anim.frames.empty()) continue;
+        for (size_t i = 0; i < activeAnimations.size(); ) {
+            AnimationInstance& instance = activeAnimations[i];
+            const Animation& anim = animations[assets::index(instance.animation)];
 
-            anim.frameTime += deltaTime;
+            instance.frameTime += deltaTime;
 
-            if (anim.frameTime >= anim.frameDuration) {
-                const int frames = static_cast<int>(anim.frameTime / anim.frameDuration);
-                anim.currentFrame += frames;
-                anim.frameTime -= anim.frameDuration * frames;
+            if (instance.frameTime >= anim.frameDuration) {
+                const int frames = static_cast<int>(instance.frameTime / anim.frameDuration);
+                instance.currentFrame += frames;
+                instance.frameTime -= anim.frameDuration * frames;
 
-                if (anim.currentFrame >= anim.frames.size()) {
+                if (instance.currentFrame >= static_cast<int>(anim.frames.size())) {
                     if (anim.looping) {
-                        anim.currentFrame = 0;
+                        instance.currentFrame %= static_cast<int>(anim.frames.size());
                     }
                     else {
-                        // Remove non-looping animations that finished
-                        std::erase_if(activeAnimations,
-                                      [&](const auto& item) {
-                                          return item.first == name;
-                                      });
-                        anim.currentFrame = static_cast<int>(anim.frames.size()) - 1;
+                        // Finished: move last instance into this slot
+                        instance = activeAnimations.back();
+                        activeAnimations.pop_back();
+                        continue;
                     }
                 }
             }
+            i++;
         }
     }
 
-void AnimationSystem::Draw() {
-    // Use indices for safe removal
-    for (size_t i = 0; i < activeAnimations.size(); ) {
-        auto& [name, transform] = activeAnimations[i];
-
-        if (!animations.contains(name)) {
-            activeAnimations.erase(activeAnimations.begin() + i);
-            continue;
-        }
-
-        Animation& anim = animations[name];
-        if (anim.currentFrame >= anim.frames.size()) {
-            activeAnimations.erase(activeAnimations.begin() + i);
-            continue;
+    void AnimationSystem::Draw() {
+        for (const auto& instance : activeAnimations) {
+            const Animation& anim = animations[assets::index(instance.animation)];
+            const components::Transform2D& transform = instance.transform;
+
+            const Rectangle frame = anim.frames[instance.currentFrame];
+            const auto [x, y] = transform.center;
+            const auto [width, height] = transform.scaledSize();
+            const float rotation = transform.angle;
+
+            // Frames are drawn centered, so a square of the larger side covers any rotation
+            const float extent = std::max(width, height);
+            if (!render::RenderCulling::IsVisible({x - extent, y - extent, 2 * extent, 2 * extent}))
+                continue;
+
+            const Rectangle source = {
+                frame.x, frame.y,
+                frame.width * (anim.flipX ? -1.0f : 1.0f),
+                frame.height * (anim.flipY ? -1.0f : 1.0f)
+            };
+
+            const Rectangle dest = {
+                x, y,
+                width, height
+            };
+
+            Vector2 origin = { width / 2, height / 2 };
+
+            if (anim.page >= 0)
+                render::RenderQueue::SubmitPage(anim.page, source, dest, origin, rotation, WHITE, render::EFFECTS);
+            else
+                render::RenderQueue::Submit(anim.texture, source, dest, origin, rotation, WHITE, render::EFFECTS);
         }
+    }
 
-        const Texture2D frame = anim.frames[anim.currentFrame];
-        const auto [x, y] = transform.center;
-        const auto [width, height] = transform.scaledSize();
-        const float rotation = transform.angle;
-
-        const Rectangle source = {
-            0.0f, 0.0f,
-            static_cast<float>(frame.width) * (anim.flipX ? -1.0f : 1.0f),
-            static_cast<float>(frame.height) * (anim.flipY ? -1.0f : 1.0f)
-        };
-
-        const Rectangle dest = {
-            x, y,
-            width, height
-        };
-
-        Vector2 origin = { width / 2, height / 2 };
+    void AnimationSystem::SaveState(snapshot::SnapshotWriter &writer) {
+        writer.writeVector(activeAnimations);
+    }
 
-        DrawTexturePro(frame, source, dest, origin, rotation, WHITE);
-        i++; // Only increment if we didn't erase
+    bool AnimationSystem::LoadState(snapshot::SnapshotReader &reader) {
+        return reader.readVector(activeAnimations);
     }
-}
 
-    bool AnimationSystem::IsPlaying(const std::string& name) {
+    bool AnimationSystem::IsPlaying(const assets::AnimationId id) {
         return std::ranges::find_if(activeAnimations,
-                                    [&](const auto& item) { return item.first == name; }) != activeAnimations.end();
+                                    [&](const auto& item) { return item.animation == id; }) != activeAnimations.end();
     }
 
     void AnimationSystem::LoadAll() {
-        Load("playerExplosion", textures::playerExplosionSheet_str.c_str(),
-            { 5, 5 }, 0.04f, false);
-        Load("asteroidExplosion", textures::asteroidExplosionSheet_str.c_str(),
-            { 3, 3 }, 0.04f, false);
+        activeAnimations.reserve(INSTANCE_POOL_CAPACITY);
+
+        if (pak::AssetPak::IsLoaded()) {
+            // Frame tables were cut by the cooker
+            for (const auto& def : pak::AssetPak::GetAnimations()) {
+                const size_t i = assets::find(assets::ANIMATIONS, def.name);
+                if (i == assets::ANIMATION_COUNT) continue;  // Pak is older than the manifest
+
+                Animation anim;
+                anim.page = def.page;
+                anim.frames = def.frames;
+                anim.frameDuration = def.frameDuration;
+                anim.looping = def.looping;
+                define(static_cast<assets::AnimationId>(i), std::move(anim));
+            }
+            return;
+        }
+
+        for (size_t i = 0; i < assets::ANIMATION_COUNT; i++) {
+            const assets::AnimationInfo& info = assets::ANIMATIONS[i];
+            const assets::TextureInfo& sheet = assets::info(info.sheet);
+            Load(static_cast<assets::AnimationId>(i), atlas::TextureAtlas::Get(info.sheet),
+                { sheet.rows, sheet.columns }, info.frameDuration, info.looping);
+        }
     }
 
     void AnimationSystem::UnloadAll() {
-        for (auto& [name, anim] : animations) {
-            for (const auto& frame : anim.frames) {
-                UnloadTexture(frame);
-            }
+        for (auto& anim : animations) {
+            if (anim.ownsTexture)
+                UnloadTexture(anim.texture);
+            anim = {};
         }
-        animations.clear();
         activeAnimations.clear();
     }
 }
@@ -0,0 +1,269 @@
+#include "core/assetPak.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#include "core/mappedFile.h"
+
+namespace core::pak {
+    std::array<std::vector<Rectangle>, assets::TEXTURE_COUNT> AssetPak::s_frames;
+    std::vector<AnimationDef> AssetPak::s_animations;
+    bool AssetPak::s_loaded = false;
+
+    namespace {
+        size_t alignUp(const size_t value) {
+            return (value + PAK_DATA_ALIGNMENT - 1) / PAK_DATA_ALIGNMENT * PAK_DATA_ALIGNMENT;
+        }
+
+        /// False if name does not fit (it has to keep the terminating zero)
+        bool copyName(char (&destination)[PAK_NAME_SIZE], const std::string &name) {
+            if (name.size() >= PAK_NAME_SIZE) return false;
+            std::memset(destination, 0, PAK_NAME_SIZE);
+            std::memcpy(destination, name.data(), name.size());
+            return true;
+        }
+
+        std::string readName(const char (&name)[PAK_NAME_SIZE]) {
+            return {name, strnlen(name, PAK_NAME_SIZE)};
+        }
+
+        PakRect toPak(const Rectangle &rect) {
+            return {rect.x, rect.y, rect.width, rect.height};
+        }
+
+        Rectangle fromPak(const PakRect &rect) {
+            return {rect.x, rect.y, rect.width, rect.height};
+        }
+
+        /// Reads count records at offset, advancing it. False if file is too short
+        template<typename T>
+        bool readTable(const mapped_file::MappedFile &file, size_t &offset, const uint32_t count, std::vector<T> &out) {
+            if (offset + static_cast<size_t>(count) * sizeof(T) > file.size())
+                return false;
+            out.resize(count);
+            std::memcpy(out.data(), file.data() + offset, count * sizeof(T));
+            offset += count * sizeof(T);
+            return true;
+        }
+    }
+
+    bool Cook(const std::vector<SheetSource> &sheets, const std::vector<AnimationSource> &animations,
+              const std::string &path) {
+        std::vector<atlas::AtlasEntry> entries;
+        entries.reserve(sheets.size());
+        for (const auto &sheet : sheets) {
+            entries.push_back({sheet.id, sheet.path});
+        }
+
+        atlas::PackedAtlas packed = atlas::packImages(entries, atlas::TextureAtlas::PAGE_SIZE,
+                                                      atlas::TextureAtlas::PADDING);
+
+        std::vector<PakRegion> regions;
+        std::vector<PakRect> frames;
+        std::unordered_map<std::string, uint32_t> regionIndices;
+        for (const auto &sheet : sheets) {
+            const auto it = packed.regions.find(sheet.id);
+            if (it == packed.regions.end()) continue;  // Failed to load, already reported
+
+            PakRegion region {};
+            if (!copyName(region.id, sheet.id)) {
+                TraceLog(LOG_ERROR, "PAK: Id %s is too long", sheet.id.c_str());
+                return false;
+            }
+            region.page = it->second.page;
+            region.rect = toPak(it->second.rect);
+            region.firstFrame = static_cast<uint32_t>(frames.size());
+            for (const auto &frame : atlas::splitSheet(it->second.rect, sheet.rows, sheet.columns)) {
+                frames.push_back(toPak(frame));
+            }
+            region.frameCount = static_cast<uint32_t>(frames.size()) - region.firstFrame;
+
+            regionIndices[sheet.id] = static_cast<uint32_t>(regions.size());
+            regions.push_back(region);
+        }
+
+        std::vector<PakAnimation> pakAnimations;
+        for (const auto &animation : animations) {
+            const auto it = regionIndices.find(animation.sheet);
+            PakAnimation pakAnimation {};
+            if (it == regionIndices.end() || !copyName(pakAnimation.name, animation.name)) {
+                TraceLog(LOG_WARNING, "PAK: Skipping animation %s", animation.name.c_str());
+                continue;
+            }
+            pakAnimation.region = it->second;
+            pakAnimation.frameDuration = animation.frameDuration;
+            pakAnimation.looping = animation.looping;
+            pakAnimations.push_back(pakAnimation);
+        }
+
+        const PakHeader header {
+            PAK_MAGIC, PAK_VERSION,
+            static_cast<uint32_t>(packed.pages.size()),
+            static_cast<uint32_t>(regions.size()),
+            static_cast<uint32_t>(frames.size()),
+            static_cast<uint32_t>(pakAnimations.size())
+        };
+
+        std::vector<PakPage> pages;
+        size_t offset = alignUp(sizeof(PakHeader) + packed.pages.size() * sizeof(PakPage) +
+                                regions.size() * sizeof(PakRegion) + frames.size() * sizeof(PakRect) +
+                                pakAnimations.size() * sizeof(PakAnimation));
+        for (const auto &image : packed.pages) {
+            // Pages come out of packImages as R8G8B8A8
+            const uint64_t size = static_cast<uint64_t>(image.width) * image.height * 4;
+            pages.push_back({static_cast<uint32_t>(image.width), static_cast<uint32_t>(image.height),
+                             image.format, 0, offset, size});
+            offset = alignUp(offset + size);
+        }
+
+        std::error_code error;
+        std::filesystem::create_directories(std::filesystem::path(path).parent_path(), error);
+
+        // Write next to the target and rename, so a failed cook never leaves a broken pak
+        const std::string temporaryPath = path + ".tmp";
+        bool written = false;
+        {
+            std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+            if (file) {
+                const auto writeBytes = [&](const void *data, const size_t size) {
+                    file.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+                };
+                const auto padTo = [&](const uint64_t position) {
+                    static constexpr char zeros[PAK_DATA_ALIGNMENT] {};
+                    writeBytes(zeros, position - static_cast<uint64_t>(file.tellp()));
+                };
+
+                writeBytes(&header, sizeof(header));
+                writeBytes(pages.data(), pages.size() * sizeof(PakPage));
+                writeBytes(regions.data(), regions.size() * sizeof(PakRegion));
+                writeBytes(frames.data(), frames.size() * sizeof(PakRect));
+                writeBytes(pakAnimations.data(), pakAnimations.size() * sizeof(PakAnimation));
+                for (size_t p = 0; p < pages.size(); p++) {
+                    padTo(pages[p].offset);
+                    writeBytes(packed.pages[p].data, pages[p].size);
+                }
+                written = static_cast<bool>(file);
+            }
+        }
+
+        for (const auto &image : packed.pages) {
+            UnloadImage(image);
+        }
+
+        if (written)
+            std::filesystem::rename(temporaryPath, path, error);
+        if (!written || error) {
+            std::filesystem::remove(temporaryPath, error);
+            TraceLog(LOG_ERROR, "PAK: Failed to write %s", path.c_str());
+            return false;
+        }
+
+        TraceLog(LOG_INFO, "PAK: Cooked %d sheet(s), %d page(s), %d animation(s) into %s",
+                 static_cast<int>(regions.size()), static_cast<int>(pages.size()),
+                 static_cast<int>(pakAnimations.size()), path.c_str());
+        return true;
+    }
+
+    bool AssetPak::Load(const std::string &path) {
+        mapped_file::MappedFile file;
+        if (!file.open(path))
+            return false;
+
+        PakHeader header;
+        if (file.size() < sizeof(header))
+            return false;
+        std::memcpy(&header, file.data(), sizeof(header));
+        if (header.magic != PAK_MAGIC || header.version != PAK_VERSION) {
+            TraceLog(LOG_WARNING, "PAK: %s has unknown format, recook it", path.c_str());
+            return false;
+        }
+
+        size_t offset = sizeof(header);
+        std::vector<PakPage> pages;
+        std::vector<PakRegion> regions;
+        std::vector<PakRect> frames;
+        std::vector<PakAnimation> animations;
+        if (!readTable(file, offset, header.pageCount, pages) ||
+            !readTable(file, offset, header.regionCount, regions) ||
+            !readTable(file, offset, header.frameCount, frames) ||
+            !readTable(file, offset, header.animationCount, animations)) {
+            TraceLog(LOG_WARNING, "PAK: %s is truncated", path.c_str());
+            return false;
+        }
+
+        // Validate everything before uploading anything
+        for (const auto &page : pages) {
+            if (page.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 ||
+                page.size != static_cast<uint64_t>(page.width) * page.height * 4 ||
+                page.offset + page.size > file.size())
+                return false;
+        }
+        for (const auto &region : regions) {
+            if (region.page < 0 || region.page >= static_cast<int32_t>(pages.size()) ||
+                region.firstFrame + static_cast<uint64_t>(region.frameCount) > frames.size())
+                return false;
+        }
+        for (const auto &animation : animations) {
+            if (animation.region >= regions.size() || regions[animation.region].frameCount == 0)
+                return false;
+        }
+
+        std::vector<Texture2D> textures;
+        textures.reserve(pages.size());
+        for (const auto &page : pages) {
+            // Pixels go to the GPU straight from the mapping, no decode and no copy
+            const Image image {
+                const_cast<std::byte *>(file.data() + page.offset),
+                static_cast<int>(page.width), static_cast<int>(page.height), 1, page.format
+            };
+            textures.push_back(LoadTextureFromImage(image));
+        }
+
+        const auto frameTable = [&](const PakRegion &region) {
+            std::vector<Rectangle> table;
+            table.reserve(region.frameCount);
+            for (uint32_t i = 0; i < region.frameCount; i++) {
+                table.push_back(fromPak(frames[region.firstFrame + i]));
+            }
+            return table;
+        };
+
+        std::unordered_map<std::string, atlas::AtlasRegion> atlasRegions;
+        std::array<std::vector<Rectangle>, assets::TEXTURE_COUNT> frameTables;
+        for (const auto &region : regions) {
+            const std::string id = readName(region.id);
+            atlasRegions[id] = {region.page, fromPak(region.rect)};
+
+            // Sheets dropped from manifest since the cook are still packed, just unused
+            if (const size_t texture = assets::find(assets::TEXTURES, id); texture < assets::TEXTURE_COUNT)
+                frameTables[texture] = frameTable(region);
+        }
+
+        std::vector<AnimationDef> animationDefs;
+        animationDefs.reserve(animations.size());
+        for (const auto &animation : animations) {
+            const PakRegion &region = regions[animation.region];
+            animationDefs.push_back({
+                readName(animation.name), region.page, frameTable(region),
+                animation.frameDuration, animation.looping != 0
+            });
+        }
+
+        atlas::TextureAtlas::Assign(std::move(textures), std::move(atlasRegions));
+        s_frames = std::move(frameTables);
+        s_animations = std::move(animationDefs);
+        s_loaded = true;
+
+        TraceLog(LOG_INFO, "PAK: Loaded %d page(s) and %d animation(s) from %s",
+                 static_cast<int>(pages.size()), static_cast<int>(s_animations.size()), path.c_str());
+        return true;
+    }
+
+    void AssetPak::Unload() {
+        s_frames.fill({});
+        s_animations.clear();
+        s_loaded = false;
+    }
+}
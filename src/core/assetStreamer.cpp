@@ -0,0 +1,230 @@
+#include "core/assetStreamer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+#include "core/allocationTracker.h"
+#include "core/profiler.h"
+
+namespace core::streaming {
+    std::deque<AssetStreamer::Request> AssetStreamer::s_requests;
+    std::deque<AssetStreamer::Request *> AssetStreamer::s_decodeQueue;
+    std::deque<StreamHandle> AssetStreamer::s_uploadQueue;
+    std::vector<std::thread> AssetStreamer::s_workers;
+    std::mutex AssetStreamer::s_mutex;
+    std::condition_variable AssetStreamer::s_wakeUp;
+    bool AssetStreamer::s_stopping = false;
+    Texture2D AssetStreamer::s_placeholder {};
+
+    namespace {
+        constexpr unsigned int MAX_WORKERS = 4;
+    }
+
+    void AssetStreamer::Init(unsigned int workerCount) {
+        if (!s_workers.empty()) return;
+
+        if (workerCount == 0) {
+            // Main thread keeps a core for itself
+            workerCount = std::clamp(std::thread::hardware_concurrency(), 2u, MAX_WORKERS + 1) - 1;
+        }
+
+        // Half transparent grey square stands in for anything not loaded yet
+        const Image placeholder = GenImageColor(1, 1, {128, 128, 128, 128});
+        s_placeholder = LoadTextureFromImage(placeholder);
+        UnloadImage(placeholder);
+
+        s_stopping = false;
+        for (unsigned int i = 0; i < workerCount; i++) {
+            s_workers.emplace_back(workerLoop);
+        }
+    }
+
+    void AssetStreamer::Shutdown() {
+        {
+            std::lock_guard lock(s_mutex);
+            s_stopping = true;
+            s_decodeQueue.clear();
+        }
+        s_wakeUp.notify_all();
+        for (auto &worker : s_workers) {
+            worker.join();
+        }
+        s_workers.clear();
+
+        for (auto &request : s_requests) {
+            if (request.image.data != nullptr)
+                UnloadImage(request.image);
+            if (request.texture.id != 0)
+                UnloadTexture(request.texture);
+        }
+        s_requests.clear();
+        s_uploadQueue.clear();
+
+        UnloadTexture(s_placeholder);
+        s_placeholder = {};
+    }
+
+    void AssetStreamer::workerLoop() {
+        profiling::Profiler::SetThreadName("Asset worker");
+        ALLOCATION_SCOPE(ASSETS);
+        while (true) {
+            Request *request;
+            {
+                std::unique_lock lock(s_mutex);
+                s_wakeUp.wait(lock, [] { return s_stopping || !s_decodeQueue.empty(); });
+                if (s_stopping) return;
+
+                request = s_decodeQueue.front();
+                s_decodeQueue.pop_front();
+            }
+
+            decode(*request);
+        }
+    }
+
+    void AssetStreamer::decode(Request &request) {
+        PROFILE_ZONE("Decode");
+        // Nobody else touches the request until its state changes
+        Image image = LoadImage(request.path.c_str());
+        if (image.data != nullptr && request.prepare)
+            request.prepare(image);
+
+        std::lock_guard lock(s_mutex);
+        if (request.state == RELEASED) {
+            if (image.data != nullptr)
+                UnloadImage(image);
+            return;
+        }
+
+        request.image = image;
+        if (image.data == nullptr) {
+            TraceLog(LOG_WARNING, "STREAM: Failed to load %s", request.path.c_str());
+            request.state = FAILED;
+        }
+        else {
+            request.state = DECODED;
+            s_uploadQueue.push_back(request.handle);
+        }
+    }
+
+    StreamHandle AssetStreamer::enqueue(const std::string &path, const bool upload,
+                                        std::function<void(Image &)> prepare) {
+        std::unique_lock lock(s_mutex);
+        const auto handle = static_cast<StreamHandle>(s_requests.size());
+        s_requests.push_back({handle, path, upload, std::move(prepare)});
+        Request &request = s_requests.back();
+
+        if (s_workers.empty()) {
+            // No workers (tools, headless runs): decode right away, upload still waits for Update
+            lock.unlock();
+            decode(request);
+            return handle;
+        }
+
+        s_decodeQueue.push_back(&request);
+        s_wakeUp.notify_one();
+        return handle;
+    }
+
+    StreamHandle AssetStreamer::RequestTexture(const std::string &path) {
+        return enqueue(path, true, {});
+    }
+
+    StreamHandle AssetStreamer::RequestImage(const std::string &path, std::function<void(Image &)> prepare) {
+        return enqueue(path, false, std::move(prepare));
+    }
+
+    void AssetStreamer::Update(const double budget) {
+        ALLOCATION_SCOPE(ASSETS);
+        PROFILE_ZONE("Asset upload");
+        using Clock = std::chrono::steady_clock;
+        const auto start = Clock::now();
+
+        while (true) {
+            Request *request;
+            {
+                std::lock_guard lock(s_mutex);
+                if (s_uploadQueue.empty()) return;
+                request = &s_requests[s_uploadQueue.front()];
+                s_uploadQueue.pop_front();
+                if (request->state == RELEASED) continue;  // Image is already unloaded
+            }
+
+            if (request->upload) {
+                request->texture = LoadTextureFromImage(request->image);
+                UnloadImage(request->image);
+                request->image = {};
+            }
+            {
+                std::lock_guard lock(s_mutex);
+                request->state = READY;
+            }
+
+            if (std::chrono::duration<double>(Clock::now() - start).count() >= budget)
+                return;
+        }
+    }
+
+    void AssetStreamer::Release(const StreamHandle handle) {
+        std::lock_guard lock(s_mutex);
+        if (handle < 0 || handle >= static_cast<StreamHandle>(s_requests.size()))
+            return;
+
+        Request &request = s_requests[handle];
+        if (request.state == QUEUED) {
+            // Not picked by a worker yet - no need to decode it at all
+            std::erase(s_decodeQueue, &request);
+        }
+        if (request.image.data != nullptr)
+            UnloadImage(request.image);
+        if (request.texture.id != 0)
+            UnloadTexture(request.texture);
+        request.image = {};
+        request.texture = {};
+        request.state = RELEASED;
+    }
+
+    void AssetStreamer::Flush() {
+        while (GetPendingCount() > 0) {
+            Update(std::numeric_limits<double>::infinity());
+            std::this_thread::yield();
+        }
+    }
+
+    StreamState AssetStreamer::GetState(const StreamHandle handle) {
+        std::lock_guard lock(s_mutex);
+        if (handle < 0 || handle >= static_cast<StreamHandle>(s_requests.size()))
+            return FAILED;
+        return s_requests[handle].state;
+    }
+
+    Texture2D AssetStreamer::GetTexture(const StreamHandle handle) {
+        // Textures are set and read on the window thread only: recorded batches carry page indices
+        if (handle < 0 || handle >= static_cast<StreamHandle>(s_requests.size()))
+            return s_placeholder;
+        const Request &request = s_requests[handle];
+        return request.texture.id != 0 ? request.texture : s_placeholder;
+    }
+
+    Image AssetStreamer::TakeImage(const StreamHandle handle) {
+        std::lock_guard lock(s_mutex);
+        if (handle < 0 || handle >= static_cast<StreamHandle>(s_requests.size()))
+            return {};
+
+        Request &request = s_requests[handle];
+        if (request.state != READY || request.upload)
+            return {};
+
+        const Image image = request.image;
+        request.image = {};
+        return image;
+    }
+
+    int AssetStreamer::GetPendingCount() {
+        std::lock_guard lock(s_mutex);
+        return static_cast<int>(std::ranges::count_if(s_requests, [](const Request &request) {
+            return request.state == QUEUED || request.state == DECODED;
+        }));
+    }
+}
@@ -22,6 +22,16 @@ namespace core::systems {
         camera.camera.zoom = camera.zoom;
     }
 
+    Rectangle CameraSystem::GetVisibleRect(const components::GameCamera& camera) {
+        const float zoom = camera.camera.zoom;
+        return {
+            camera.camera.target.x - camera.camera.offset.x / zoom,
+            camera.camera.target.y - camera.camera.offset.y / zoom,
+            static_cast<float>(GetScreenWidth()) / zoom,
+            static_cast<float>(GetScreenHeight()) / zoom
+        };
+    }
+
     void CameraSystem::BeginCameraDraw(const components::GameCamera& camera) {
         BeginMode2D(camera.camera);
     }
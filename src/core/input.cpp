@@ -0,0 +1,59 @@
+#include "core/input.h"
+
+namespace core::input {
+    InputState Input::s_pending;
+    InputState Input::s_current;
+    std::mutex Input::s_mutex;
+
+    namespace {
+        bool inRange(const int value, const int count) {
+            return value >= 0 && value < count;
+        }
+    }
+
+    void Input::Capture() {
+        std::lock_guard lock(s_mutex);
+        for (int key = 0; key < InputState::KEY_COUNT; key++) {
+            s_pending.keysDown[key] = ::IsKeyDown(key);
+            if (::IsKeyPressed(key))
+                s_pending.keysPressed[key] = true;
+        }
+        for (int button = 0; button < InputState::BUTTON_COUNT; button++) {
+            s_pending.buttonsDown[button] = ::IsMouseButtonDown(button);
+            if (::IsMouseButtonPressed(button))
+                s_pending.buttonsPressed[button] = true;
+            if (::IsMouseButtonReleased(button))
+                s_pending.buttonsReleased[button] = true;
+        }
+        s_pending.mousePosition = ::GetMousePosition();
+    }
+
+    void Input::BeginTick() {
+        std::lock_guard lock(s_mutex);
+        s_current = s_pending;
+        // Held state carries over to ticks without a captured frame in between, edges do not
+        s_pending.keysPressed.reset();
+        s_pending.buttonsPressed.reset();
+        s_pending.buttonsReleased.reset();
+    }
+
+    bool Input::IsKeyDown(const int key) {
+        return inRange(key, InputState::KEY_COUNT) && s_current.keysDown[key];
+    }
+
+    bool Input::IsKeyPressed(const int key) {
+        return inRange(key, InputState::KEY_COUNT) && s_current.keysPressed[key];
+    }
+
+    bool Input::IsMouseButtonDown(const int button) {
+        return inRange(button, InputState::BUTTON_COUNT) && s_current.buttonsDown[button];
+    }
+
+    bool Input::IsMouseButtonPressed(const int button) {
+        return inRange(button, InputState::BUTTON_COUNT) && s_current.buttonsPressed[button];
+    }
+
+    bool Input::IsMouseButtonReleased(const int button) {
+        return inRange(button, InputState::BUTTON_COUNT) && s_current.buttonsReleased[button];
+    }
+}
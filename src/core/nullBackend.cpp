@@ -0,0 +1,345 @@
+// Null implementation of the part of raylib the game uses.
+// Linked instead of raylib into headless targets: no window, no GPU, scripted input
+
+#include "core/nullBackend.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+#include "raylib.h"
+#include "rlgl.h"
+
+namespace core::headless {
+    namespace {
+        constexpr int MAX_KEYS = 512;
+        constexpr int MAX_MOUSE_BUTTONS = 8;
+
+        struct InputEvent {
+            unsigned long frame;
+            enum { KEY, MOUSE_MOVE, MOUSE_BUTTON } type;
+            int code;
+            bool down;
+            Vector2 position;
+        };
+
+        struct State {
+            int screenWidth = 0;
+            int screenHeight = 0;
+            float frameTime = 1.f / 60;
+            double time = 0;
+            unsigned long frame = 0;
+
+            std::array<bool, MAX_KEYS> keys {};
+            std::array<bool, MAX_KEYS> previousKeys {};
+            std::array<bool, MAX_MOUSE_BUTTONS> mouse {};
+            std::array<bool, MAX_MOUSE_BUTTONS> previousMouse {};
+            Vector2 mousePosition {0, 0};
+
+            std::vector<InputEvent> script;
+            size_t nextEvent = 0;
+            unsigned int nextTextureId = 1;
+        };
+
+        State &state() {
+            static State s_state;
+            return s_state;
+        }
+
+        int parseKey(const std::string &name) {
+            static const std::unordered_map<std::string, int> keys = {
+                {"SPACE", KEY_SPACE}, {"A", KEY_A}, {"D", KEY_D}, {"J", KEY_J}, {"S", KEY_S},
+                {"W", KEY_W}, {"RIGHT", KEY_RIGHT}, {"LEFT", KEY_LEFT}, {"DOWN", KEY_DOWN},
+                {"UP", KEY_UP}, {"LEFT_CONTROL", KEY_LEFT_CONTROL}, {"RIGHT_CONTROL", KEY_RIGHT_CONTROL},
+            };
+            if (const auto it = keys.find(name); it != keys.end())
+                return it->second;
+
+            char *end = nullptr;
+            const long code = std::strtol(name.c_str(), &end, 10);
+            if (end == name.c_str() || *end != '\0' || code < 0 || code >= MAX_KEYS)
+                return -1;
+            return static_cast<int>(code);
+        }
+    }
+
+    void SetFrameTime(const float frameTime) {
+        state().frameTime = frameTime;
+    }
+
+    bool LoadInputScript(const std::string &path) {
+        std::ifstream file(path);
+        if (!file) return false;
+
+        std::vector<InputEvent> events;
+        std::string line;
+        while (std::getline(file, line)) {
+            line = line.substr(0, line.find('#'));
+            std::istringstream stream(line);
+
+            unsigned long frame;
+            std::string target;
+            if (!(stream >> frame >> target))
+                continue;  // Blank or comment line
+
+            InputEvent event {frame, InputEvent::KEY, 0, false, {0, 0}};
+            if (target == "mouse") {
+                event.type = InputEvent::MOUSE_MOVE;
+                if (!(stream >> event.position.x >> event.position.y))
+                    return false;
+            }
+            else {
+                std::string action;
+                if (!(stream >> action) || (action != "down" && action != "up"))
+                    return false;
+                event.down = action == "down";
+
+                if (target == "mouse_left") {
+                    event.type = InputEvent::MOUSE_BUTTON;
+                    event.code = MOUSE_BUTTON_LEFT;
+                }
+                else if ((event.code = parseKey(target)) < 0) {
+                    return false;
+                }
+            }
+            events.push_back(event);
+        }
+
+        std::ranges::stable_sort(events, {}, &InputEvent::frame);
+        state().script = std::move(events);
+        state().nextEvent = 0;
+        return true;
+    }
+
+    void SetKeyDown(const int key, const bool down) {
+        if (key >= 0 && key < MAX_KEYS)
+            state().keys[key] = down;
+    }
+
+    void BeginFrame() {
+        State &s = state();
+        s.frame++;
+        s.time += s.frameTime;
+        s.previousKeys = s.keys;
+        s.previousMouse = s.mouse;
+
+        for (; s.nextEvent < s.script.size() && s.script[s.nextEvent].frame <= s.frame; s.nextEvent++) {
+            const InputEvent &event = s.script[s.nextEvent];
+            switch (event.type) {
+                case InputEvent::KEY:
+                    s.keys[event.code] = event.down;
+                    break;
+                case InputEvent::MOUSE_MOVE:
+                    s.mousePosition = event.position;
+                    break;
+                case InputEvent::MOUSE_BUTTON:
+                    s.mouse[event.code] = event.down;
+                    break;
+            }
+        }
+    }
+
+    unsigned long GetFrameIndex() {
+        return state().frame;
+    }
+}
+
+using core::headless::state;
+
+#pragma region Window and timing
+void InitWindow(const int width, const int height, const char *) {
+    state().screenWidth = width;
+    state().screenHeight = height;
+}
+
+void CloseWindow() {}
+bool WindowShouldClose() { return false; }
+bool IsWindowReady() { return true; }
+void SetConfigFlags(unsigned int) {}
+void SetTargetFPS(int) {}
+float GetFrameTime() { return state().frameTime; }
+double GetTime() { return state().time; }
+int GetFPS() { return state().frameTime > 0 ? static_cast<int>(1 / state().frameTime) : 0; }
+int GetScreenWidth() { return state().screenWidth; }
+int GetScreenHeight() { return state().screenHeight; }
+#pragma endregion
+
+#pragma region Input
+bool IsKeyDown(const int key) {
+    return key >= 0 && key < core::headless::MAX_KEYS && state().keys[key];
+}
+
+bool IsKeyPressed(const int key) {
+    return IsKeyDown(key) && !state().previousKeys[key];
+}
+
+bool IsKeyReleased(const int key) {
+    return key >= 0 && key < core::headless::MAX_KEYS && !state().keys[key] && state().previousKeys[key];
+}
+
+bool IsMouseButtonDown(const int button) {
+    return button >= 0 && button < core::headless::MAX_MOUSE_BUTTONS && state().mouse[button];
+}
+
+bool IsMouseButtonPressed(const int button) {
+    return IsMouseButtonDown(button) && !state().previousMouse[button];
+}
+
+bool IsMouseButtonReleased(const int button) {
+    return button >= 0 && button < core::headless::MAX_MOUSE_BUTTONS &&
+           !state().mouse[button] && state().previousMouse[button];
+}
+
+Vector2 GetMousePosition() { return state().mousePosition; }
+Vector2 GetMouseDelta() { return {0, 0}; }
+#pragma endregion
+
+#pragma region Misc
+void TraceLog(const int logLevel, const char *text, ...) {
+    if (logLevel < LOG_WARNING) return;
+
+    va_list args;
+    va_start(args, text);
+    std::fputs(logLevel >= LOG_ERROR ? "ERROR: " : "WARNING: ", stderr);
+    std::vfprintf(stderr, text, args);
+    std::fputc('\n', stderr);
+    va_end(args);
+}
+
+void SetTraceLogLevel(int) {}
+
+int GetRandomValue(int min, int max) {
+    // Same as raylib's default rand() based implementation
+    if (min > max) std::swap(min, max);
+    return min + std::rand() % (std::abs(max - min) + 1);
+}
+
+void SetRandomSeed(const unsigned int seed) { std::srand(seed); }
+
+const char *TextFormat(const char *text, ...) {
+    static char buffer[1024];
+    va_list args;
+    va_start(args, text);
+    std::vsnprintf(buffer, sizeof(buffer), text, args);
+    va_end(args);
+    return buffer;
+}
+
+int MeasureText(const char *text, const int fontSize) {
+    return static_cast<int>(std::char_traits<char>::length(text)) * fontSize / 2;
+}
+
+bool FileExists(const char *fileName) {
+    return std::filesystem::exists(fileName);
+}
+
+long GetFileModTime(const char *fileName) {
+    std::error_code error;
+    const auto time = std::filesystem::last_write_time(fileName, error);
+    if (error) return 0;
+    return static_cast<long>(std::chrono::duration_cast<std::chrono::seconds>(
+        time.time_since_epoch()).count());
+}
+#pragma endregion
+
+#pragma region Collision math (gameplay depends on it, so it is real)
+bool CheckCollisionRecs(const Rectangle rec1, const Rectangle rec2) {
+    return rec1.x < rec2.x + rec2.width && rec1.x + rec1.width > rec2.x &&
+           rec1.y < rec2.y + rec2.height && rec1.y + rec1.height > rec2.y;
+}
+
+bool CheckCollisionPointRec(const Vector2 point, const Rectangle rec) {
+    return point.x >= rec.x && point.x < rec.x + rec.width &&
+           point.y >= rec.y && point.y < rec.y + rec.height;
+}
+
+bool CheckCollisionCircles(const Vector2 center1, const float radius1,
+                           const Vector2 center2, const float radius2) {
+    const float dx = center2.x - center1.x;
+    const float dy = center2.y - center1.y;
+    return dx * dx + dy * dy <= (radius1 + radius2) * (radius1 + radius2);
+}
+
+Rectangle GetCollisionRec(const Rectangle rec1, const Rectangle rec2) {
+    const float left = std::max(rec1.x, rec2.x);
+    const float right = std::min(rec1.x + rec1.width, rec2.x + rec2.width);
+    const float top = std::max(rec1.y, rec2.y);
+    const float bottom = std::min(rec1.y + rec1.height, rec2.y + rec2.height);
+    if (left >= right || top >= bottom)
+        return {0, 0, 0, 0};
+    return {left, top, right - left, bottom - top};
+}
+#pragma endregion
+
+#pragma region Images and textures (no pixels, no GPU)
+Image LoadImage(const char *) { return {}; }
+Image LoadImageFromTexture(Texture2D) { return {}; }
+void UnloadImage(Image) {}
+bool ExportImage(Image, const char *) { return false; }
+Image GenImageColor(const int width, const int height, Color) { return {nullptr, width, height, 1, 0}; }
+Image ImageCopy(const Image image) { return {nullptr, image.width, image.height, 1, image.format}; }
+Image ImageFromImage(Image, const Rectangle rec) {
+    return {nullptr, static_cast<int>(rec.width), static_cast<int>(rec.height), 1, 0};
+}
+void ImageFormat(Image *, int) {}
+void ImageCrop(Image *image, const Rectangle crop) {
+    image->width = static_cast<int>(crop.width);
+    image->height = static_cast<int>(crop.height);
+}
+void ImageResize(Image *image, const int newWidth, const int newHeight) {
+    image->width = newWidth;
+    image->height = newHeight;
+}
+void ImageDraw(Image *, Image, Rectangle, Rectangle, Color) {}
+
+Texture2D LoadTexture(const char *) { return {}; }
+Texture2D LoadTextureFromImage(const Image image) {
+    // Valid id, so code that checks for a loaded texture keeps working
+    return {state().nextTextureId++, image.width, image.height, 1, image.format};
+}
+void UnloadTexture(Texture2D) {}
+void UpdateTexture(Texture2D, const void *) {}
+void SetTextureFilter(Texture2D, int) {}
+#pragma endregion
+
+#pragma region Drawing
+Color Fade(const Color color, const float alpha) {
+    return {color.r, color.g, color.b, static_cast<unsigned char>(255.f * std::clamp(alpha, 0.f, 1.f))};
+}
+
+void ClearBackground(Color) {}
+void BeginDrawing() {}
+void EndDrawing() {}
+void BeginMode2D(Camera2D) {}
+void EndMode2D() {}
+void DrawTexture(Texture2D, int, int, Color) {}
+void DrawTextureRec(Texture2D, Rectangle, Vector2, Color) {}
+void DrawTexturePro(Texture2D, Rectangle, Rectangle, Vector2, float, Color) {}
+void DrawCircle(int, int, float, Color) {}
+void DrawCircleV(Vector2, float, Color) {}
+void DrawCircleLines(int, int, float, Color) {}
+void DrawRectangle(int, int, int, int, Color) {}
+void DrawRectangleRec(Rectangle, Color) {}
+void DrawRectangleLines(int, int, int, int, Color) {}
+void DrawRectangleLinesEx(Rectangle, float, Color) {}
+void DrawLineV(Vector2, Vector2, Color) {}
+void DrawTriangle(Vector2, Vector2, Vector2, Color) {}
+void DrawFPS(int, int) {}
+void DrawText(const char *, int, int, int, Color) {}
+
+void rlSetTexture(unsigned int) {}
+void rlBegin(int) {}
+void rlEnd() {}
+void rlColor4ub(unsigned char, unsigned char, unsigned char, unsigned char) {}
+void rlNormal3f(float, float, float) {}
+void rlTexCoord2f(float, float) {}
+void rlVertex2f(float, float) {}
+unsigned int rlGetTextureIdDefault() { return 0; }
+#pragma endregion
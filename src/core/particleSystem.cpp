@@ -0,0 +1,242 @@
+#include "core/particleSystem.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PARTICLES_SSE2
+#endif
+
+#include "rlgl.h"
+#include "core/renderCulling.h"
+#include "core/renderQueue.h"
+
+namespace core::particles {
+    std::vector<float> ParticleSystem::s_posX;
+    std::vector<float> ParticleSystem::s_posY;
+    std::vector<float> ParticleSystem::s_velX;
+    std::vector<float> ParticleSystem::s_velY;
+    std::vector<float> ParticleSystem::s_life;
+    std::vector<float> ParticleSystem::s_invMaxLife;
+    std::vector<float> ParticleSystem::s_size;
+    std::vector<float> ParticleSystem::s_drag;
+    std::vector<Color> ParticleSystem::s_color;
+    size_t ParticleSystem::s_count = 0;
+
+    std::vector<Emitter> ParticleSystem::s_emitters;
+    std::vector<EmitterHandle> ParticleSystem::s_freeEmitters;
+
+    uint32_t ParticleSystem::s_randomState = 0x9E3779B9u;
+
+    float ParticleSystem::random(const float min, const float max) {
+        // xorshift32 - GetRandomValue is too slow for hundreds of calls per burst
+        s_randomState ^= s_randomState << 13;
+        s_randomState ^= s_randomState >> 17;
+        s_randomState ^= s_randomState << 5;
+        return min + (max - min) * static_cast<float>(s_randomState >> 8) / static_cast<float>(1 << 24);
+    }
+
+    void ParticleSystem::Init(const size_t capacity) {
+        // Padded to SIMD width so vector loop never reads past the end
+        const size_t padded = (capacity + 3) & ~static_cast<size_t>(3);
+        for (auto *array : {&s_posX, &s_posY, &s_velX, &s_velY, &s_life, &s_invMaxLife, &s_size, &s_drag})
+            array->assign(padded, 0.f);
+        s_color.assign(padded, BLANK);
+        s_count = 0;
+    }
+
+    void ParticleSystem::Shutdown() {
+        for (auto *array : {&s_posX, &s_posY, &s_velX, &s_velY, &s_life, &s_invMaxLife, &s_size, &s_drag}) {
+            array->clear();
+            array->shrink_to_fit();
+        }
+        s_color.clear();
+        s_color.shrink_to_fit();
+        s_count = 0;
+        s_emitters.clear();
+        s_freeEmitters.clear();
+    }
+
+    void ParticleSystem::spawn(const Vector2 position, const Vector2 direction, const ParticleParams &params) {
+        if (s_count >= s_posX.size()) return;
+
+        const float angle = std::atan2(direction.y, direction.x) + random(-params.spread / 2, params.spread / 2);
+        const float speed = random(params.minSpeed, params.maxSpeed);
+        const float life = random(params.minLife, params.maxLife);
+
+        const size_t i = s_count++;
+        s_posX[i] = position.x;
+        s_posY[i] = position.y;
+        s_velX[i] = std::cos(angle) * speed;
+        s_velY[i] = std::sin(angle) * speed;
+        s_life[i] = life;
+        s_invMaxLife[i] = 1.f / life;
+        s_size[i] = random(params.minSize, params.maxSize);
+        s_drag[i] = params.drag;
+        s_color[i] = params.color;
+    }
+
+    void ParticleSystem::Burst(const Vector2 position, const int count, const ParticleParams &params,
+                               const Vector2 direction) {
+        for (int i = 0; i < count; i++)
+            spawn(position, direction, params);
+    }
+
+    EmitterHandle ParticleSystem::CreateEmitter(const ParticleParams &params, const float rate) {
+        EmitterHandle handle;
+        if (!s_freeEmitters.empty()) {
+            handle = s_freeEmitters.back();
+            s_freeEmitters.pop_back();
+        }
+        else {
+            s_emitters.emplace_back();
+            handle = static_cast<EmitterHandle>(s_emitters.size()) - 1;
+        }
+
+        s_emitters[handle] = {params, {0, 0}, {1, 0}, rate, 0, false, true};
+        return handle;
+    }
+
+    void ParticleSystem::DestroyEmitter(const EmitterHandle handle) {
+        if (handle < 0 || handle >= static_cast<int>(s_emitters.size()) || !s_emitters[handle].alive)
+            return;
+
+        s_emitters[handle].alive = false;
+        s_emitters[handle].active = false;
+        s_freeEmitters.push_back(handle);
+    }
+
+    void ParticleSystem::SetEmitterTransform(const EmitterHandle handle, const Vector2 position,
+                                             const Vector2 direction) {
+        if (handle < 0 || handle >= static_cast<int>(s_emitters.size())) return;
+
+        s_emitters[handle].position = position;
+        s_emitters[handle].direction = direction;
+    }
+
+    void ParticleSystem::SetEmitterActive(const EmitterHandle handle, const bool active) {
+        if (handle < 0 || handle >= static_cast<int>(s_emitters.size())) return;
+
+        s_emitters[handle].active = active && s_emitters[handle].alive;
+    }
+
+    void ParticleSystem::integrate(const float deltaTime) {
+        size_t i = 0;
+
+#ifdef PARTICLES_SSE2
+        const __m128 dt = _mm_set1_ps(deltaTime);
+        for (; i + 4 <= s_count; i += 4) {
+            // Linear approximation of pow(drag, dt) - exact enough for small dt
+            const __m128 one = _mm_set1_ps(1.f);
+            const __m128 damping = _mm_sub_ps(one, _mm_mul_ps(_mm_sub_ps(one, _mm_loadu_ps(&s_drag[i])), dt));
+
+            const __m128 vx = _mm_mul_ps(_mm_loadu_ps(&s_velX[i]), damping);
+            const __m128 vy = _mm_mul_ps(_mm_loadu_ps(&s_velY[i]), damping);
+            _mm_storeu_ps(&s_velX[i], vx);
+            _mm_storeu_ps(&s_velY[i], vy);
+
+            _mm_storeu_ps(&s_posX[i], _mm_add_ps(_mm_loadu_ps(&s_posX[i]), _mm_mul_ps(vx, dt)));
+            _mm_storeu_ps(&s_posY[i], _mm_add_ps(_mm_loadu_ps(&s_posY[i]), _mm_mul_ps(vy, dt)));
+            _mm_storeu_ps(&s_life[i], _mm_sub_ps(_mm_loadu_ps(&s_life[i]), dt));
+        }
+#endif
+
+        for (; i < s_count; i++) {
+            const float damping = 1.f - (1.f - s_drag[i]) * deltaTime;
+            s_velX[i] *= damping;
+            s_velY[i] *= damping;
+            s_posX[i] += s_velX[i] * deltaTime;
+            s_posY[i] += s_velY[i] * deltaTime;
+            s_life[i] -= deltaTime;
+        }
+    }
+
+    void ParticleSystem::removeDead() {
+        // Swap-remove: last alive particle takes the dead one's slot
+        for (size_t i = 0; i < s_count;) {
+            if (s_life[i] > 0) {
+                i++;
+                continue;
+            }
+
+            const size_t last = --s_count;
+            s_posX[i] = s_posX[last];
+            s_posY[i] = s_posY[last];
+            s_velX[i] = s_velX[last];
+            s_velY[i] = s_velY[last];
+            s_life[i] = s_life[last];
+            s_invMaxLife[i] = s_invMaxLife[last];
+            s_size[i] = s_size[last];
+            s_drag[i] = s_drag[last];
+            s_color[i] = s_color[last];
+        }
+    }
+
+    void ParticleSystem::Update(const float deltaTime) {
+        for (auto &emitter : s_emitters) {
+            if (!emitter.active) {
+                emitter.accumulator = 0;
+                continue;
+            }
+
+            emitter.accumulator += emitter.rate * deltaTime;
+            for (; emitter.accumulator >= 1; emitter.accumulator -= 1)
+                spawn(emitter.position, emitter.direction, emitter.params);
+            emitter.active = false;
+        }
+
+        integrate(deltaTime);
+        removeDead();
+    }
+
+    void ParticleSystem::Draw() {
+        // rlgl default texture is a 1x1 white pixel - every particle goes into one batch
+        const Texture2D white = {rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+        const Rectangle &view = render::RenderCulling::GetView();
+        const float right = view.x + view.width;
+        const float bottom = view.y + view.height;
+
+        for (size_t i = 0; i < s_count; i++) {
+            const float x = s_posX[i];
+            const float y = s_posY[i];
+            if (x < view.x || x > right || y < view.y || y > bottom) continue;
+
+            Color color = s_color[i];
+            color.a = static_cast<unsigned char>(static_cast<float>(color.a) *
+                                                 std::clamp(s_life[i] * s_invMaxLife[i], 0.f, 1.f));
+            const float size = s_size[i];
+            render::RenderQueue::Submit(white, {0, 0, 1, 1}, {x, y, size, size},
+                                        {size / 2, size / 2}, 0, color, render::EFFECTS);
+        }
+    }
+
+    void ParticleSystem::SaveState(snapshot::SnapshotWriter &writer) {
+        for (const auto *array : {&s_posX, &s_posY, &s_velX, &s_velY, &s_life, &s_invMaxLife, &s_size, &s_drag})
+            writer.writeArray(array->data(), s_count);
+        writer.writeArray(s_color.data(), s_count);
+        writer.writeVector(s_emitters);
+        writer.writeVector(s_freeEmitters);
+        writer.write(s_randomState);
+    }
+
+    bool ParticleSystem::LoadState(snapshot::SnapshotReader &reader) {
+        const size_t count = reader.readArray(s_posX.data(), s_posX.size());
+        for (auto *array : {&s_posY, &s_velX, &s_velY, &s_life, &s_invMaxLife, &s_size, &s_drag}) {
+            if (reader.readArray(array->data(), array->size()) != count)
+                return false;
+        }
+        if (reader.readArray(s_color.data(), s_color.size()) != count)
+            return false;
+        reader.readVector(s_emitters);
+        reader.readVector(s_freeEmitters);
+        reader.read(s_randomState);
+
+        s_count = reader.failed() ? 0 : count;
+        return !reader.failed();
+    }
+
+    void ParticleSystem::Clear() {
+        s_count = 0;
+    }
+}
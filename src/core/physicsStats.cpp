@@ -0,0 +1,71 @@
+#include "core/physicsStats.h"
+
+#include <algorithm>
+#include <bit>
+
+#include "raylib.h"
+
+namespace core::physics_stats {
+    StepStats PhysicsStats::s_current;
+    StepStats PhysicsStats::s_lastStep;
+
+    void Histogram::add(const uint32_t value) {
+        const int bucket = std::min(static_cast<int>(std::bit_width(value)), BUCKETS - 1);
+        buckets[bucket]++;
+        count++;
+        sum += value;
+        max = std::max(max, value);
+    }
+
+    uint32_t Histogram::percentile(const float p) const {
+        if (count == 0) return 0;
+
+        const auto wanted = static_cast<uint32_t>(p * static_cast<float>(count - 1)) + 1;
+        uint32_t seen = 0;
+        for (int bucket = 0; bucket < BUCKETS; bucket++) {
+            seen += buckets[bucket];
+            if (seen >= wanted)
+                return std::min(bucket == 0 ? 0u : (1u << bucket) - 1, max);
+        }
+        return max;
+    }
+
+    int PhysicsStats::DrawOverlay(const StepStats &stats, const int x, const int y) {
+        constexpr int fontSize = 10;
+        constexpr int lineHeight = 12;
+        constexpr int columns[] = {0, 110, 160, 210, 260};
+        const int height = 7 * lineHeight + 8;
+        DrawRectangle(x, y, 310, height, Fade(BLACK, 0.7f));
+
+        int lineY = y + 4;
+        DrawText(TextFormat("step: %u pairs  %u tests  %u contacts",
+                            stats.broadPhasePairs, stats.narrowPhaseTests, stats.contacts),
+                 x + 4, lineY, fontSize, YELLOW);
+        lineY += lineHeight;
+        DrawText(TextFormat("box reject: %u  inner accept: %u", stats.aabbRejects, stats.innerBoxAccepts),
+                 x + 4, lineY, fontSize, RAYWHITE);
+        lineY += lineHeight;
+
+        const char *header[] = {"iterations", "runs", "mean", "p99", "max"};
+        for (int column = 0; column < 5; column++)
+            DrawText(header[column], x + 4 + columns[column], lineY, fontSize, YELLOW);
+        lineY += lineHeight;
+
+        const std::pair<const char *, const Histogram *> rows[] = {
+            {"GJK", &stats.gjkIterations}, {"EPA", &stats.epaIterations}, {"push-apart", &stats.pushApartSteps}
+        };
+        for (const auto &[name, histogram] : rows) {
+            DrawText(name, x + 4, lineY, fontSize, RAYWHITE);
+            DrawText(TextFormat("%u", histogram->count), x + 4 + columns[1], lineY, fontSize, RAYWHITE);
+            DrawText(TextFormat("%.1f", histogram->mean()), x + 4 + columns[2], lineY, fontSize, RAYWHITE);
+            DrawText(TextFormat("%u", histogram->percentile(0.99f)), x + 4 + columns[3], lineY, fontSize, RAYWHITE);
+            DrawText(TextFormat("%u", histogram->max), x + 4 + columns[4], lineY, fontSize, RAYWHITE);
+            lineY += lineHeight;
+        }
+
+#ifndef GAME_PROFILER
+        DrawText("built without GAME_PROFILER", x + 4, lineY, fontSize, GRAY);
+#endif
+        return height;
+    }
+}
@@ -0,0 +1,127 @@
+#include "core/poissonDisk.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace core::poisson_disk {
+    namespace {
+        constexpr int RANDOM_RESOLUTION = 1 << 20;
+
+        /// Uniform in [0, 1]
+        float randomUnit() {
+            return static_cast<float>(GetRandomValue(0, RANDOM_RESOLUTION)) / RANDOM_RESOLUTION;
+        }
+
+        float distanceSquared(const Vector2 a, const Vector2 b) {
+            const float dx = a.x - b.x;
+            const float dy = a.y - b.y;
+            return dx * dx + dy * dy;
+        }
+    }
+
+    PoissonDiskSampler::PoissonDiskSampler(const Vector2 center, const float radius, const float minDistance):
+    center_(center), radius_(radius), minDistance_(minDistance),
+    // Cell diagonal equals minDistance, so a cell can hold a single point
+    cellSize_(minDistance / std::numbers::sqrt2_v<float>) {
+        gridSize_ = static_cast<int>(std::ceil(2 * radius / cellSize_)) + 1;
+        grid_.assign(static_cast<size_t>(gridSize_) * gridSize_, -1);
+    }
+
+    int PoissonDiskSampler::cellOf(const float coordinate, const float origin) const {
+        return std::clamp(static_cast<int>((coordinate - origin + radius_) / cellSize_), 0, gridSize_ - 1);
+    }
+
+    bool PoissonDiskSampler::isFree(const Vector2 point) const {
+        if (distanceSquared(point, center_) > radius_ * radius_)
+            return false;
+
+        for (const auto &[exclusionCenter, exclusionRadius] : exclusions_) {
+            if (distanceSquared(point, exclusionCenter) < exclusionRadius * exclusionRadius)
+                return false;
+        }
+
+        // Points closer than minDistance are at most two cells away
+        const int cellX = cellOf(point.x, center_.x);
+        const int cellY = cellOf(point.y, center_.y);
+        for (int y = std::max(cellY - 2, 0); y <= std::min(cellY + 2, gridSize_ - 1); y++) {
+            for (int x = std::max(cellX - 2, 0); x <= std::min(cellX + 2, gridSize_ - 1); x++) {
+                const int other = grid_[y * gridSize_ + x];
+                if (other >= 0 && distanceSquared(point, points_[other]) < minDistance_ * minDistance_)
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    void PoissonDiskSampler::insert(const Vector2 point) {
+        const int cell = cellOf(point.y, center_.y) * gridSize_ + cellOf(point.x, center_.x);
+        grid_[cell] = static_cast<int>(points_.size());
+        points_.push_back(point);
+    }
+
+    void PoissonDiskSampler::addObstacle(const Vector2 point) {
+        // Obstacles may be closer to each other than minDistance; keep any one per cell,
+        // the rest still block through exclusions
+        const int cell = cellOf(point.y, center_.y) * gridSize_ + cellOf(point.x, center_.x);
+        if (grid_[cell] < 0)
+            insert(point);
+        else
+            addExclusion(point, minDistance_);
+    }
+
+    void PoissonDiskSampler::addExclusion(const Vector2 center, const float radius) {
+        exclusions_.push_back({center, radius});
+    }
+
+    size_t PoissonDiskSampler::sample(const size_t count, std::vector<Vector2> &out) {
+        const size_t firstNew = points_.size();
+        const auto added = [&] { return points_.size() - firstNew; };
+
+        // Uniform darts keep sparse fills spread over the whole circle
+        int misses = 0;
+        for (size_t attempt = 0; added() < count && attempt < count * ATTEMPTS && misses < MAX_DART_MISSES; attempt++) {
+            // sqrt keeps the density uniform over the disk
+            const float distance = radius_ * std::sqrt(randomUnit());
+            const float angle = 2 * std::numbers::pi_v<float> * randomUnit();
+            const Vector2 point = {center_.x + distance * std::cos(angle), center_.y + distance * std::sin(angle)};
+            if (isFree(point)) {
+                insert(point);
+                misses = 0;
+            }
+            else misses++;
+        }
+
+        // Darts keep missing once the circle is crowded - grow from existing points instead
+        std::vector<int> active;
+        if (added() < count) {
+            active.resize(points_.size());
+            for (size_t i = 0; i < points_.size(); i++) active[i] = static_cast<int>(i);
+        }
+        while (added() < count && !active.empty()) {
+            const size_t slot = GetRandomValue(0, static_cast<int>(active.size()) - 1);
+            const Vector2 origin = points_[active[slot]];
+
+            bool found = false;
+            for (int attempt = 0; attempt < ATTEMPTS && !found; attempt++) {
+                // Annulus [minDistance, 2 minDistance] around the active point
+                const float distance = minDistance_ * (1 + randomUnit());
+                const float angle = 2 * std::numbers::pi_v<float> * randomUnit();
+                const Vector2 point = {origin.x + distance * std::cos(angle), origin.y + distance * std::sin(angle)};
+                if (isFree(point)) {
+                    insert(point);
+                    active.push_back(static_cast<int>(points_.size()) - 1);
+                    found = true;
+                }
+            }
+
+            if (!found) {
+                active[slot] = active.back();
+                active.pop_back();
+            }
+        }
+
+        out.insert(out.end(), points_.begin() + static_cast<long>(firstNew), points_.end());
+        return added();
+    }
+}
@@ -0,0 +1,275 @@
+#include "core/profiler.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "raylib.h"
+
+namespace core::profiling {
+    namespace {
+        struct Event {
+            const char *name;
+            uint64_t start;
+            uint64_t end;
+        };
+
+        struct ZoneHistory {
+            const char *name;
+            std::array<float, Profiler::HISTORY_FRAMES> samples {};
+            size_t count = 0;
+            size_t next = 0;
+            /// Sum over current frame, nanoseconds
+            uint64_t frameTotal = 0;
+        };
+
+        struct Frame {
+            uint64_t start;
+            uint64_t end;
+        };
+
+        /// Events are written only by its thread; readers copy them and drop what was overwritten
+        /// meanwhile. Frame history too, but the overlay reads it from another thread under historyMutex
+        struct ThreadBuffer {
+            std::string name;
+            uint32_t id = 0;
+            std::unique_ptr<Event[]> events = std::make_unique<Event[]>(Profiler::EVENTS_PER_THREAD);
+            std::atomic<uint64_t> head = 0;
+
+            uint64_t frameFirstEvent = 0;
+            uint64_t frameStart = 0;
+            std::array<Frame, Profiler::EXPORT_FRAMES> frames {};
+            size_t frameCount = 0;
+
+            std::mutex historyMutex;
+            std::vector<ZoneHistory> zones;
+            std::unordered_map<std::string_view, size_t> zoneIndex;
+        };
+
+        std::mutex s_threadsMutex;
+        /// Buffers outlive their threads, so late exports still see what they did
+        std::vector<std::unique_ptr<ThreadBuffer>> s_threads;
+        thread_local ThreadBuffer *t_buffer = nullptr;
+        bool s_overlayVisible = false;
+
+        ThreadBuffer &threadBuffer() {
+            if (t_buffer == nullptr) {
+                std::lock_guard lock(s_threadsMutex);
+                auto &buffer = s_threads.emplace_back(std::make_unique<ThreadBuffer>());
+                buffer->id = static_cast<uint32_t>(s_threads.size());
+                buffer->name = "Thread " + std::to_string(buffer->id);
+                t_buffer = buffer.get();
+            }
+            return *t_buffer;
+        }
+
+        /// Events of buffer with index >= first, oldest first. Safe against concurrent writer
+        void snapshot(const ThreadBuffer &buffer, uint64_t first, std::vector<Event> &out) {
+            constexpr uint64_t capacity = Profiler::EVENTS_PER_THREAD;
+            const uint64_t head = buffer.head.load(std::memory_order_acquire);
+            first = std::max(first, head > capacity ? head - capacity : 0);
+
+            const size_t copied = out.size();
+            for (uint64_t i = first; i < head; i++)
+                out.push_back(buffer.events[i % capacity]);
+
+            // Slots writer reached while copying hold newer events now
+            const uint64_t after = buffer.head.load(std::memory_order_acquire);
+            if (after > capacity && after - capacity > first) {
+                const auto overwritten = std::min<uint64_t>(after - capacity - first, head - first);
+                out.erase(out.begin() + static_cast<long>(copied),
+                          out.begin() + static_cast<long>(copied + overwritten));
+            }
+        }
+
+        void writeEscaped(FILE *file, const char *text) {
+            for (; *text; text++) {
+                if (*text == '"' || *text == '\\') std::fputc('\\', file);
+                std::fputc(*text, file);
+            }
+        }
+    }
+
+    uint64_t Now() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    void Profiler::SetThreadName(const char *name) {
+        ThreadBuffer &buffer = threadBuffer();
+        std::lock_guard lock(s_threadsMutex);
+        buffer.name = name;
+    }
+
+    void Profiler::Record(const char *name, const uint64_t start, const uint64_t end) {
+        ThreadBuffer &buffer = threadBuffer();
+        const uint64_t head = buffer.head.load(std::memory_order_relaxed);
+        buffer.events[head % EVENTS_PER_THREAD] = {name, start, end};
+        buffer.head.store(head + 1, std::memory_order_release);
+    }
+
+    void Profiler::BeginFrame() {
+        ThreadBuffer &buffer = threadBuffer();
+        buffer.frameFirstEvent = buffer.head.load(std::memory_order_relaxed);
+        buffer.frameStart = Now();
+    }
+
+    void Profiler::EndFrame() {
+        ThreadBuffer &buffer = threadBuffer();
+        if (buffer.frameStart == 0) return;
+
+        const uint64_t frameEnd = Now();
+        Record("Frame", buffer.frameStart, frameEnd);
+        buffer.frames[buffer.frameCount++ % EXPORT_FRAMES] = {buffer.frameStart, frameEnd};
+
+        std::lock_guard lock(buffer.historyMutex);
+        const uint64_t head = buffer.head.load(std::memory_order_relaxed);
+        const uint64_t first = std::max(buffer.frameFirstEvent, head > EVENTS_PER_THREAD ? head - EVENTS_PER_THREAD : 0);
+        for (uint64_t i = first; i < head; i++) {
+            const Event &event = buffer.events[i % EVENTS_PER_THREAD];
+            auto [it, inserted] = buffer.zoneIndex.try_emplace(event.name, buffer.zones.size());
+            if (inserted)
+                buffer.zones.push_back({event.name});
+            buffer.zones[it->second].frameTotal += event.end - event.start;
+        }
+
+        // Zones that did not run this frame count as zero, e.g. frames without a physics step
+        for (auto &zone : buffer.zones) {
+            zone.samples[zone.next] = static_cast<float>(zone.frameTotal) / 1e6f;
+            zone.next = (zone.next + 1) % HISTORY_FRAMES;
+            zone.count = std::min(zone.count + 1, HISTORY_FRAMES);
+            zone.frameTotal = 0;
+        }
+    }
+
+    void Profiler::ToggleOverlay() {
+        s_overlayVisible = !s_overlayVisible;
+    }
+
+    bool Profiler::IsOverlayVisible() {
+        return s_overlayVisible;
+    }
+
+    void Profiler::GetZoneStats(std::vector<ZoneStats> &out) {
+        out.clear();
+        std::vector<float> sorted;
+        std::lock_guard threadsLock(s_threadsMutex);
+        for (const auto &buffer : s_threads) {
+            std::lock_guard lock(buffer->historyMutex);
+            for (const auto &zone : buffer->zones) {
+                if (zone.count == 0) continue;
+
+                sorted.assign(zone.samples.begin(), zone.samples.begin() + static_cast<long>(zone.count));
+                std::ranges::sort(sorted);
+                out.push_back({buffer->name.c_str(), zone.name, Percentile(sorted, 0.5f), Percentile(sorted, 0.95f),
+                               Percentile(sorted, 0.99f), sorted.back()});
+            }
+        }
+    }
+
+    void Profiler::GetLastFrame(std::vector<ZoneSample> &out) {
+        out.clear();
+        ThreadBuffer &buffer = threadBuffer();
+        std::lock_guard lock(buffer.historyMutex);
+        for (const auto &zone : buffer.zones) {
+            if (zone.count == 0) continue;
+            out.push_back({zone.name, zone.samples[(zone.next + HISTORY_FRAMES - 1) % HISTORY_FRAMES]});
+        }
+    }
+
+    int Profiler::DrawOverlay(const int x, const int y) {
+        if (!s_overlayVisible) return 0;
+
+        static std::vector<ZoneStats> stats;
+        GetZoneStats(stats);
+
+        constexpr int fontSize = 10;
+        constexpr int lineHeight = 12;
+        constexpr int columns[] = {0, 110, 160, 210, 260};
+        // Rows go under a line naming the thread they ran on
+        int rows = static_cast<int>(stats.size()) + 1;
+        for (size_t i = 0; i < stats.size(); i++) {
+            if (i == 0 || stats[i].thread != stats[i - 1].thread) rows++;
+        }
+        const int height = rows * lineHeight + 8;
+        DrawRectangle(x, y, 310, height, Fade(BLACK, 0.7f));
+
+        const char *header[] = {"zone, ms", "p50", "p95", "p99", "max"};
+        for (int column = 0; column < 5; column++)
+            DrawText(header[column], x + 4 + columns[column], y + 4, fontSize, YELLOW);
+
+#ifndef GAME_PROFILER
+        DrawText("built without GAME_PROFILER", x + 4, y + 4 + lineHeight, fontSize, GRAY);
+#endif
+        int lineY = y + 4 + lineHeight;
+        const char *thread = nullptr;
+        for (const auto &[zoneThread, name, p50, p95, p99, max] : stats) {
+            if (zoneThread != thread) {
+                thread = zoneThread;
+                DrawText(thread, x + 4, lineY, fontSize, SKYBLUE);
+                lineY += lineHeight;
+            }
+            DrawText(name, x + 12, lineY, fontSize, RAYWHITE);
+            const float values[] = {p50, p95, p99, max};
+            for (int column = 0; column < 4; column++)
+                DrawText(TextFormat("%.2f", values[column]), x + 4 + columns[column + 1], lineY, fontSize, RAYWHITE);
+            lineY += lineHeight;
+        }
+        return height;
+    }
+
+    bool Profiler::ExportTrace(const char *path) {
+        const ThreadBuffer &caller = threadBuffer();
+        const size_t frames = std::min(caller.frameCount, EXPORT_FRAMES);
+        if (frames == 0) return false;
+        const uint64_t exportStart = caller.frames[(caller.frameCount - frames) % EXPORT_FRAMES].start;
+
+        FILE *file = std::fopen(path, "w");
+        if (file == nullptr) {
+            TraceLog(LOG_WARNING, "PROFILER: Failed to open %s", path);
+            return false;
+        }
+
+        std::fputs("{\"traceEvents\":[\n", file);
+        bool firstEvent = true;
+        const auto separator = [&] {
+            if (!firstEvent) std::fputs(",\n", file);
+            firstEvent = false;
+        };
+
+        std::lock_guard lock(s_threadsMutex);
+        std::vector<Event> events;
+        for (const auto &buffer : s_threads) {
+            separator();
+            std::fprintf(file, R"({"name":"thread_name","ph":"M","pid":1,"tid":%u,"args":{"name":")", buffer->id);
+            writeEscaped(file, buffer->name.c_str());
+            std::fputs("\"}}", file);
+
+            events.clear();
+            snapshot(*buffer, 0, events);
+            for (const auto &[name, start, end] : events) {
+                if (start < exportStart) continue;
+
+                separator();
+                std::fputs(R"({"name":")", file);
+                writeEscaped(file, name);
+                // Trace format wants microseconds
+                std::fprintf(file, R"(","ph":"X","pid":1,"tid":%u,"ts":%.3f,"dur":%.3f})", buffer->id,
+                             static_cast<double>(start - exportStart) / 1e3,
+                             static_cast<double>(end - start) / 1e3);
+            }
+        }
+        std::fputs("\n]}\n", file);
+        std::fclose(file);
+
+        TraceLog(LOG_INFO, "PROFILER: Wrote %zu frames to %s", frames, path);
+        return true;
+    }
+}
@@ -0,0 +1,54 @@
+#include "core/renderCulling.h"
+
+#include "game/physicsWorld.h"
+
+namespace core::render {
+    std::vector<game::game_objects::CollidingObject*> RenderCulling::s_candidates(256);
+    Rectangle RenderCulling::s_view {0, 0, 0, 0};
+    CullingStats RenderCulling::s_stats;
+    CullingStats RenderCulling::s_lastStats;
+
+    void RenderCulling::BeginFrame(const Rectangle &view) {
+        s_view = view;
+        s_stats = {};
+    }
+
+    void RenderCulling::EndFrame() {
+        s_lastStats = s_stats;
+    }
+
+    void RenderCulling::DrawVisible(const std::vector<game::game_objects::DrawnGameObject*> &unindexed,
+                                    const size_t total) {
+        using game::physics::PhysicsWorld;
+
+        const Rectangle area = {s_view.x - BODY_DRAW_MARGIN, s_view.y - BODY_DRAW_MARGIN,
+                                s_view.width + 2 * BODY_DRAW_MARGIN, s_view.height + 2 * BODY_DRAW_MARGIN};
+        size_t found;
+        while ((found = PhysicsWorld::QueryBounds(area, s_candidates)) == s_candidates.size())
+            s_candidates.resize(s_candidates.size() * 2);
+
+        int drawn = 0;
+        for (size_t i = 0; i < found; i++) {
+            const auto object = dynamic_cast<game::game_objects::DrawnGameObject*>(s_candidates[i]);
+            if (object == nullptr || !CheckCollisionRecs(object->getDrawBounds(), s_view)) continue;
+            object->draw();
+            drawn++;
+        }
+
+        for (auto* object : unindexed) {
+            if (!object->isActive() || !CheckCollisionRecs(object->getDrawBounds(), s_view)) continue;
+            object->draw();
+            drawn++;
+        }
+
+        s_stats.drawn += drawn;
+        s_stats.culled += static_cast<int>(total) - drawn;
+    }
+
+    bool RenderCulling::IsVisible(const Rectangle &bounds) {
+        const bool visible = CheckCollisionRecs(bounds, s_view);
+        if (visible) s_stats.drawn++;
+        else s_stats.culled++;
+        return visible;
+    }
+}
@@ -0,0 +1,216 @@
+#include "core/renderQueue.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "rlgl.h"
+#include "core/textureAtlas.h"
+
+namespace core::render {
+    thread_local std::vector<SpriteRecord> RenderQueue::s_sprites;
+    thread_local std::vector<CircleRecord> RenderQueue::s_circles;
+    thread_local std::vector<uint32_t> RenderQueue::s_keys;
+    thread_local std::vector<uint32_t> RenderQueue::s_order;
+    thread_local std::vector<uint32_t> RenderQueue::s_keysTmp;
+    thread_local std::vector<uint32_t> RenderQueue::s_orderTmp;
+    thread_local RenderBatch RenderQueue::s_flushBatch;
+    thread_local RenderStats RenderQueue::s_lastStats;
+
+    namespace {
+        /// Layer goes to the high 16 bits, texture id to the low ones
+        uint32_t makeKey(const int layer, const unsigned int textureId) {
+            const int clamped = std::clamp(layer, -32768, 32767) + 32768;
+            return static_cast<uint32_t>(clamped) << 16 | (textureId & 0xFFFF);
+        }
+
+        /// Pages count down from the top of the id range, far from real texture ids.
+        /// A clash would only split a batch, as drawing compares resolved ids
+        unsigned int sortId(const SpriteRecord &sprite) {
+            return sprite.page >= 0 ? 0xFFFFu - static_cast<unsigned int>(sprite.page) : sprite.texture.id;
+        }
+    }
+
+    void RenderQueue::Submit(const Texture2D &texture, const Rectangle &source,
+                             const Rectangle &dest, const Vector2 origin,
+                             const float rotation, const Color tint, const int layer) {
+        Submit({texture, source, dest, origin, rotation, tint, layer});
+    }
+
+    void RenderQueue::Submit(const SpriteRecord &sprite) {
+        if (sprite.page < 0 && sprite.texture.id == 0) return;
+
+        s_sprites.push_back(sprite);
+        s_keys.push_back(makeKey(sprite.layer, sortId(sprite)));
+    }
+
+    void RenderQueue::SubmitPage(const int page, const Rectangle &source, const Rectangle &dest,
+                                 const Vector2 origin, const float rotation, const Color tint, const int layer) {
+        if (page < 0) return;
+        Submit({{}, source, dest, origin, rotation, tint, layer, page});
+    }
+
+    void RenderQueue::SubmitCircleLines(const Vector2 center, const float radius, const Color color) {
+        s_circles.push_back({center, radius, color});
+    }
+
+    void RenderQueue::sortByKey() {
+        const size_t count = s_keys.size();
+
+        s_order.resize(count);
+        for (size_t i = 0; i < count; i++)
+            s_order[i] = static_cast<uint32_t>(i);
+
+        s_keysTmp.resize(count);
+        s_orderTmp.resize(count);
+
+        // LSD radix sort, 8 bits per pass. Stable, so submission order is kept
+        // inside one (layer, texture) run
+        for (int shift = 0; shift < 32; shift += 8) {
+            size_t buckets[256] = {};
+            for (const uint32_t key : s_keys)
+                buckets[key >> shift & 0xFF]++;
+
+            // All keys share this digit - nothing to reorder
+            if (buckets[s_keys[0] >> shift & 0xFF] == count)
+                continue;
+
+            size_t offset = 0;
+            for (auto &bucket : buckets) {
+                const size_t size = bucket;
+                bucket = offset;
+                offset += size;
+            }
+
+            for (size_t i = 0; i < count; i++) {
+                const size_t dst = buckets[s_keys[i] >> shift & 0xFF]++;
+                s_keysTmp[dst] = s_keys[i];
+                s_orderTmp[dst] = s_order[i];
+            }
+
+            s_keys.swap(s_keysTmp);
+            s_order.swap(s_orderTmp);
+        }
+    }
+
+    void RenderQueue::emitQuad(const SpriteRecord &sprite, const Texture2D &texture) {
+        // Mirrors DrawTexturePro, minus texture bind which is done per batch
+        Rectangle source = sprite.source;
+        Rectangle dest = sprite.dest;
+        const auto width = static_cast<float>(texture.width);
+        const auto height = static_cast<float>(texture.height);
+
+        bool flipX = false;
+        if (source.width < 0) {
+            flipX = true;
+            source.width *= -1;
+        }
+        if (source.height < 0) source.y -= source.height;
+        if (dest.width < 0) dest.width *= -1;
+        if (dest.height < 0) dest.height *= -1;
+
+        Vector2 topLeft, topRight, bottomLeft, bottomRight;
+        if (sprite.rotation == 0.0f) {
+            const float x = dest.x - sprite.origin.x;
+            const float y = dest.y - sprite.origin.y;
+            topLeft = {x, y};
+            topRight = {x + dest.width, y};
+            bottomLeft = {x, y + dest.height};
+            bottomRight = {x + dest.width, y + dest.height};
+        }
+        else {
+            const float sinRotation = sinf(sprite.rotation * DEG2RAD);
+            const float cosRotation = cosf(sprite.rotation * DEG2RAD);
+            const float dx = -sprite.origin.x;
+            const float dy = -sprite.origin.y;
+
+            topLeft = {dest.x + dx * cosRotation - dy * sinRotation,
+                       dest.y + dx * sinRotation + dy * cosRotation};
+            topRight = {dest.x + (dx + dest.width) * cosRotation - dy * sinRotation,
+                        dest.y + (dx + dest.width) * sinRotation + dy * cosRotation};
+            bottomLeft = {dest.x + dx * cosRotation - (dy + dest.height) * sinRotation,
+                          dest.y + dx * sinRotation + (dy + dest.height) * cosRotation};
+            bottomRight = {dest.x + (dx + dest.width) * cosRotation - (dy + dest.height) * sinRotation,
+                           dest.y + (dx + dest.width) * sinRotation + (dy + dest.height) * cosRotation};
+        }
+
+        const float left = source.x / width;
+        const float right = (source.x + source.width) / width;
+        const float top = source.y / height;
+        const float bottom = (source.y + source.height) / height;
+
+        rlColor4ub(sprite.tint.r, sprite.tint.g, sprite.tint.b, sprite.tint.a);
+        rlNormal3f(0.0f, 0.0f, 1.0f);
+
+        rlTexCoord2f(flipX ? right : left, top);
+        rlVertex2f(topLeft.x, topLeft.y);
+
+        rlTexCoord2f(flipX ? right : left, bottom);
+        rlVertex2f(bottomLeft.x, bottomLeft.y);
+
+        rlTexCoord2f(flipX ? left : right, bottom);
+        rlVertex2f(bottomRight.x, bottomRight.y);
+
+        rlTexCoord2f(flipX ? left : right, top);
+        rlVertex2f(topRight.x, topRight.y);
+    }
+
+    void RenderQueue::Flush() {
+        Take(s_flushBatch);
+        Draw(s_flushBatch);
+    }
+
+    void RenderQueue::Take(RenderBatch &batch) {
+        batch.clear();
+        batch.circles.swap(s_circles);
+
+        if (!s_sprites.empty()) {
+            sortByKey();
+            batch.sprites.reserve(s_sprites.size());
+            for (const uint32_t index : s_order)
+                batch.sprites.push_back(s_sprites[index]);
+        }
+        Clear();
+    }
+
+    void RenderQueue::Draw(const RenderBatch &batch) {
+        s_lastStats = {};
+        for (const auto &[center, radius, color] : batch.circles)
+            DrawCircleLines(static_cast<int>(center.x), static_cast<int>(center.y), radius, color);
+
+        if (batch.sprites.empty()) return;
+
+        unsigned int boundTexture = 0;
+        int resolvedPage = -1;
+        Texture2D pageTexture {};
+        for (const SpriteRecord &sprite : batch.sprites) {
+            // Sprites of one page are consecutive, so it is looked up once per run
+            if (sprite.page >= 0 && sprite.page != resolvedPage) {
+                resolvedPage = sprite.page;
+                pageTexture = atlas::TextureAtlas::GetPageTexture(sprite.page);
+            }
+            const Texture2D &texture = sprite.page >= 0 ? pageTexture : sprite.texture;
+            if (texture.id == 0) continue;
+
+            if (texture.id != boundTexture) {
+                if (boundTexture != 0) rlEnd();
+
+                boundTexture = texture.id;
+                rlSetTexture(boundTexture);
+                rlBegin(RL_QUADS);
+                s_lastStats.batches++;
+            }
+
+            emitQuad(sprite, texture);
+            s_lastStats.sprites++;
+        }
+
+        if (boundTexture != 0) rlEnd();
+        rlSetTexture(0);
+    }
+
+    void RenderQueue::Clear() {
+        s_sprites.clear();
+        s_circles.clear();
+        s_keys.clear();
+    }
+}
@@ -0,0 +1,82 @@
+#include "core/spatialGrid.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace core::spatial {
+    SpatialGrid::SpatialGrid(const float cellSize, const uint32_t bucketCount):
+    cellSize_(cellSize), bucketMask_(std::bit_ceil(std::max(bucketCount, 2u)) - 1) {
+        cellStart_.assign(bucketMask_ + 2, 0);
+    }
+
+    void SpatialGrid::cellRange(const Rectangle &area, int &x0, int &y0, int &x1, int &y1) const {
+        x0 = static_cast<int>(std::floor(area.x / cellSize_));
+        y0 = static_cast<int>(std::floor(area.y / cellSize_));
+        x1 = static_cast<int>(std::floor((area.x + area.width) / cellSize_));
+        y1 = static_cast<int>(std::floor((area.y + area.height) / cellSize_));
+    }
+
+    bool SpatialGrid::mark(const uint32_t item) const {
+        if (marks_[item] == queryStamp_)
+            return false;
+        marks_[item] = queryStamp_;
+        return true;
+    }
+
+    void SpatialGrid::nextStamp() const {
+        if (marks_.size() < bounds_.size())
+            marks_.resize(bounds_.size(), 0);
+
+        if (++queryStamp_ == 0) {
+            // Stamp wrapped around - old marks could collide with new ones
+            std::ranges::fill(marks_, 0);
+            queryStamp_ = 1;
+        }
+    }
+
+    void SpatialGrid::clear() {
+        bounds_.clear();
+        pending_.clear();
+        entries_.clear();
+        oversized_.clear();
+        std::ranges::fill(cellStart_, 0);
+    }
+
+    uint32_t SpatialGrid::insert(const Rectangle &bounds) {
+        const auto item = static_cast<uint32_t>(bounds_.size());
+        bounds_.push_back(bounds);
+
+        int x0, y0, x1, y1;
+        cellRange(bounds, x0, y0, x1, y1);
+        if ((x1 - x0 + 1) * (y1 - y0 + 1) > MAX_CELLS_PER_ITEM) {
+            oversized_.push_back(item);
+            return item;
+        }
+
+        for (int cy = y0; cy <= y1; cy++) {
+            for (int cx = x0; cx <= x1; cx++) {
+                pending_.emplace_back(bucketOf(cx, cy), item);
+            }
+        }
+        return item;
+    }
+
+    void SpatialGrid::build() {
+        // Counting sort of pending pairs by bucket
+        std::ranges::fill(cellStart_, 0);
+        for (const auto &[bucket, item] : pending_)
+            cellStart_[bucket + 1]++;
+
+        for (size_t i = 1; i < cellStart_.size(); i++)
+            cellStart_[i] += cellStart_[i - 1];
+
+        entries_.resize(pending_.size());
+        cursor_.assign(cellStart_.begin(), cellStart_.end() - 1);
+        for (const auto &[bucket, item] : pending_)
+            entries_[cursor_[bucket]++] = item;
+
+        marks_.assign(bounds_.size(), 0);
+        queryStamp_ = 0;
+    }
+}
@@ -0,0 +1,347 @@
+#include "core/textureAtlas.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <numeric>
+
+#include "texturePaths.h"
+
+namespace core::atlas {
+    std::vector<Texture2D> TextureAtlas::s_pages;
+    std::vector<streaming::StreamHandle> TextureAtlas::s_pageStreams;
+    std::array<AtlasRegion, assets::TEXTURE_COUNT> TextureAtlas::s_regions;
+
+    namespace {
+        constexpr int CACHE_VERSION = 2;
+
+        std::string pagePath(const std::string &cacheDir, const size_t page) {
+            return cacheDir + "/atlas_" + std::to_string(page) + ".png";
+        }
+
+        std::string indexPath(const std::string &cacheDir) {
+            return cacheDir + "/atlas.idx";
+        }
+    }
+
+    std::vector<Rectangle> splitSheet(const Rectangle sheet, const int rows, const int columns) {
+        std::vector<Rectangle> frames;
+        frames.reserve(rows * columns);
+
+        const float frameWidth = sheet.width / static_cast<float>(columns);
+        const float frameHeight = sheet.height / static_cast<float>(rows);
+        for (int i = 0; i < rows; i++) {
+            for (int j = 0; j < columns; j++) {
+                frames.push_back({sheet.x + static_cast<float>(j) * frameWidth,
+                                  sheet.y + static_cast<float>(i) * frameHeight,
+                                  frameWidth, frameHeight});
+            }
+        }
+        return frames;
+    }
+
+#pragma region SkylinePacker
+    SkylinePacker::SkylinePacker(const int width, const int height):
+    width_(width), height_(height) {
+        skyline_.push_back({0, 0, width});
+    }
+
+    int SkylinePacker::fitAt(const size_t segment, const int width, const int height) const {
+        if (skyline_[segment].x + width > width_)
+            return -1;
+
+        int y = skyline_[segment].y;
+        int widthLeft = width;
+        for (size_t i = segment; widthLeft > 0; i++) {
+            if (i >= skyline_.size())
+                return -1;
+
+            y = std::max(y, skyline_[i].y);
+            if (y + height > height_)
+                return -1;
+
+            widthLeft -= skyline_[i].width;
+        }
+        return y;
+    }
+
+    bool SkylinePacker::insert(const int width, const int height, int &x, int &y) {
+        int bestIndex = -1;
+        int bestTop = std::numeric_limits<int>::max();
+        int bestX = 0;
+
+        // Bottom-left rule: lowest resulting top edge, then leftmost
+        for (size_t i = 0; i < skyline_.size(); i++) {
+            const int fitY = fitAt(i, width, height);
+            if (fitY < 0) continue;
+
+            if (fitY + height < bestTop) {
+                bestTop = fitY + height;
+                bestIndex = static_cast<int>(i);
+                bestX = skyline_[i].x;
+                y = fitY;
+            }
+        }
+
+        if (bestIndex < 0)
+            return false;
+
+        x = bestX;
+        skyline_.insert(skyline_.begin() + bestIndex, {x, y + height, width});
+
+        // Cut segments now covered by the new one
+        for (size_t i = bestIndex + 1; i < skyline_.size();) {
+            const Segment &previous = skyline_[i - 1];
+            const int previousEnd = previous.x + previous.width;
+            if (skyline_[i].x >= previousEnd)
+                break;
+
+            const int shrink = previousEnd - skyline_[i].x;
+            skyline_[i].x += shrink;
+            skyline_[i].width -= shrink;
+            if (skyline_[i].width > 0)
+                break;
+
+            skyline_.erase(skyline_.begin() + static_cast<int>(i));
+        }
+
+        // Merge neighbours on the same height
+        for (size_t i = 0; i + 1 < skyline_.size();) {
+            if (skyline_[i].y == skyline_[i + 1].y) {
+                skyline_[i].width += skyline_[i + 1].width;
+                skyline_.erase(skyline_.begin() + static_cast<int>(i) + 1);
+            }
+            else i++;
+        }
+
+        usedHeight_ = std::max(usedHeight_, y + height);
+        return true;
+    }
+#pragma endregion
+
+    PackedAtlas packImages(const std::vector<AtlasEntry> &entries, const int pageSize, const int padding) {
+        struct Page {
+            SkylinePacker packer;
+            Image image;
+        };
+
+        std::vector<Image> images;
+        images.reserve(entries.size());
+        for (const auto &entry : entries) {
+            Image image = LoadImage(entry.path.c_str());
+            ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+            images.push_back(image);
+        }
+
+        // Tall images first - skyline packs much tighter that way
+        std::vector<size_t> order(entries.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::ranges::sort(order, [&](const size_t a, const size_t b) {
+            return images[a].height > images[b].height;
+        });
+
+        std::vector<Page> pages;
+        PackedAtlas result;
+        for (const size_t i : order) {
+            const Image &image = images[i];
+            if (image.data == nullptr) {
+                TraceLog(LOG_WARNING, "ATLAS: Failed to load %s", entries[i].path.c_str());
+                continue;
+            }
+
+            const int width = image.width + padding;
+            const int height = image.height + padding;
+            int x = 0, y = 0;
+            int page = -1;
+
+            for (size_t p = 0; p < pages.size() && page < 0; p++) {
+                if (pages[p].packer.insert(width, height, x, y))
+                    page = static_cast<int>(p);
+            }
+
+            if (page < 0) {
+                // Oversized images get a page of their own size
+                const int pageWidth = std::max(pageSize, width);
+                const int pageHeight = std::max(pageSize, height);
+                pages.push_back({SkylinePacker(pageWidth, pageHeight),
+                                 GenImageColor(pageWidth, pageHeight, BLANK)});
+                page = static_cast<int>(pages.size()) - 1;
+                pages.back().packer.insert(width, height, x, y);
+            }
+
+            const Rectangle rect = {static_cast<float>(x), static_cast<float>(y),
+                                    static_cast<float>(image.width), static_cast<float>(image.height)};
+            ImageDraw(&pages[page].image, image,
+                      {0, 0, static_cast<float>(image.width), static_cast<float>(image.height)},
+                      rect, WHITE);
+            result.regions[entries[i].id] = {page, rect};
+        }
+
+        for (const auto &image : images) {
+            UnloadImage(image);
+        }
+
+        for (auto &[packer, image] : pages) {
+            // Drop unused rows at the bottom
+            ImageCrop(&image, {0, 0, static_cast<float>(image.width),
+                               static_cast<float>(packer.getUsedHeight())});
+            result.pages.push_back(image);
+        }
+        return result;
+    }
+
+#pragma region TextureAtlas
+    bool TextureAtlas::loadCache(const std::vector<AtlasEntry> &entries, const std::string &cacheDir) {
+        std::ifstream index(indexPath(cacheDir));
+        if (!index) return false;
+
+        int version = 0;
+        size_t sourceCount = 0;
+        std::string tag;
+        if (!(index >> tag >> version) || tag != "ATLAS" || version != CACHE_VERSION)
+            return false;
+        if (!(index >> tag >> sourceCount) || tag != "sources" || sourceCount != entries.size())
+            return false;
+
+        // Any changed, added or reordered source invalidates the cache
+        for (const auto &entry : entries) {
+            std::string id;
+            long modTime = 0;
+            std::string path;
+            index >> id >> modTime;
+            std::getline(index >> std::ws, path);
+
+            if (!index || id != entry.id || path != entry.path ||
+                modTime != GetFileModTime(entry.path.c_str()))
+                return false;
+        }
+
+        size_t pageCount = 0;
+        if (!(index >> tag >> pageCount) || tag != "pages")
+            return false;
+        for (size_t page = 0; page < pageCount; page++) {
+            if (!FileExists(pagePath(cacheDir, page).c_str()))
+                return false;
+        }
+
+        // Sources that failed to load have no region; they stay missing until their file changes
+        size_t regionCount = 0;
+        if (!(index >> tag >> regionCount) || tag != "regions" || regionCount > entries.size())
+            return false;
+
+        std::unordered_map<std::string, AtlasRegion> regions;
+        for (size_t i = 0; i < regionCount; i++) {
+            std::string id;
+            AtlasRegion region;
+            index >> id >> region.page >> region.rect.x >> region.rect.y
+                  >> region.rect.width >> region.rect.height;
+            if (!index || region.page < 0 || region.page >= static_cast<int>(pageCount))
+                return false;
+            regions[id] = region;
+        }
+
+        for (size_t page = 0; page < pageCount; page++) {
+            // Regions are known already, so pixels can arrive later
+            s_pages.push_back({});
+            s_pageStreams.push_back(streaming::AssetStreamer::RequestTexture(pagePath(cacheDir, page)));
+        }
+        setRegions(regions);
+        return true;
+    }
+
+    void TextureAtlas::pack(const std::vector<AtlasEntry> &entries, const std::string &cacheDir) {
+        PackedAtlas packed = packImages(entries, PAGE_SIZE, PADDING);
+
+        std::error_code error;
+        std::filesystem::create_directories(cacheDir, error);
+        const bool canCache = !error;
+
+        for (size_t p = 0; p < packed.pages.size(); p++) {
+            if (canCache)
+                ExportImage(packed.pages[p], pagePath(cacheDir, p).c_str());
+
+            s_pages.push_back(LoadTextureFromImage(packed.pages[p]));
+            s_pageStreams.push_back(streaming::INVALID_STREAM);
+            UnloadImage(packed.pages[p]);
+        }
+
+        if (canCache) {
+            std::ofstream index(indexPath(cacheDir));
+            index << "ATLAS " << CACHE_VERSION << '\n';
+            index << "sources " << entries.size() << '\n';
+            for (const auto &entry : entries) {
+                index << entry.id << ' ' << GetFileModTime(entry.path.c_str()) << ' ' << entry.path << '\n';
+            }
+            index << "pages " << packed.pages.size() << '\n';
+            index << "regions " << packed.regions.size() << '\n';
+            for (const auto &entry : entries) {
+                const auto it = packed.regions.find(entry.id);
+                if (it == packed.regions.end()) continue;
+
+                const AtlasRegion &region = it->second;
+                index << entry.id << ' ' << region.page << ' ' << region.rect.x << ' ' << region.rect.y
+                      << ' ' << region.rect.width << ' ' << region.rect.height << '\n';
+            }
+        }
+
+        setRegions(packed.regions);
+    }
+
+    void TextureAtlas::Build(const std::vector<AtlasEntry> &entries, const std::string &cacheDir) {
+        UnloadAll();
+
+        if (loadCache(entries, cacheDir)) {
+            TraceLog(LOG_INFO, "ATLAS: Loaded %d page(s) from cache", GetPageCount());
+            return;
+        }
+
+        pack(entries, cacheDir);
+        TraceLog(LOG_INFO, "ATLAS: Packed %d image(s) into %d page(s)",
+                 static_cast<int>(entries.size()), GetPageCount());
+    }
+
+    void TextureAtlas::LoadAll() {
+        std::vector<AtlasEntry> entries;
+        entries.reserve(assets::TEXTURE_COUNT);
+        for (const auto &texture : assets::TEXTURES) {
+            entries.push_back({std::string(texture.name), texture.path});
+        }
+        Build(entries, textures::atlasCacheDir);
+    }
+
+    void TextureAtlas::UnloadAll() {
+        for (size_t page = 0; page < s_pages.size(); page++) {
+            if (s_pageStreams[page] != streaming::INVALID_STREAM)
+                streaming::AssetStreamer::Release(s_pageStreams[page]);
+            else
+                UnloadTexture(s_pages[page]);
+        }
+        s_pages.clear();
+        s_pageStreams.clear();
+        s_regions.fill({});
+    }
+
+    void TextureAtlas::Assign(std::vector<Texture2D> pages, std::unordered_map<std::string, AtlasRegion> regions) {
+        UnloadAll();
+        s_pages = std::move(pages);
+        s_pageStreams.assign(s_pages.size(), streaming::INVALID_STREAM);
+        setRegions(regions);
+    }
+
+    void TextureAtlas::setRegions(const std::unordered_map<std::string, AtlasRegion> &regions) {
+        for (size_t i = 0; i < assets::TEXTURE_COUNT; i++) {
+            const auto it = regions.find(std::string(assets::TEXTURES[i].name));
+            s_regions[i] = it != regions.end() ? it->second : AtlasRegion {};
+        }
+    }
+
+    Texture2D TextureAtlas::GetPageTexture(const int page) {
+        if (page < 0 || page >= static_cast<int>(s_pages.size()))
+            return {};
+        if (s_pageStreams[page] != streaming::INVALID_STREAM)
+            return streaming::AssetStreamer::GetTexture(s_pageStreams[page]);
+        return s_pages[page];
+    }
+#pragma endregion
+}
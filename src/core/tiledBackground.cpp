@@ -0,0 +1,186 @@
+#include "core/tiledBackground.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "core/renderQueue.h"
+
+namespace core::render {
+    TiledBackground::TiledBackground(std::string path, const Rectangle &area, const int tileSize,
+                                     const int mipLevels, const float parallax):
+    path_(std::move(path)), area_(area), tileSize_(tileSize), parallax_(parallax) {
+        levels_.resize(std::max(mipLevels, 1));
+        requestSource();
+    }
+
+    TiledBackground::~TiledBackground() {
+        unload();
+    }
+
+    void TiledBackground::requestSource() {
+        sourceStream_ = streaming::AssetStreamer::RequestImage(path_, [](Image &image) {
+            ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        });
+    }
+
+    bool TiledBackground::acquireSource() {
+        if (source_.data != nullptr)
+            return true;
+        if (sourceStream_ == streaming::INVALID_STREAM)
+            requestSource();
+        if (!streaming::AssetStreamer::IsReady(sourceStream_))
+            return false;
+
+        source_ = streaming::AssetStreamer::TakeImage(sourceStream_);
+        return source_.data != nullptr;
+    }
+
+    TiledBackground::MipLevel &TiledBackground::getLevel(const int level) {
+        MipLevel &mip = levels_[level];
+        if (mip.image.data != nullptr)
+            return mip;
+
+        // Level 0 shares the decoded image, others are downscaled copies of it
+        if (level == 0) {
+            mip.image = source_;
+        }
+        else {
+            mip.image = ImageCopy(source_);
+            ImageResize(&mip.image, std::max(source_.width >> level, 1),
+                        std::max(source_.height >> level, 1));
+        }
+
+        mip.tilesX = (mip.image.width + tileSize_ - 1) / tileSize_;
+        mip.tilesY = (mip.image.height + tileSize_ - 1) / tileSize_;
+        mip.tiles.resize(mip.tilesX * mip.tilesY);
+        return mip;
+    }
+
+    Texture2D TiledBackground::getTile(MipLevel &mip, const int tileX, const int tileY) {
+        Tile &tile = mip.tiles[tileY * mip.tilesX + tileX];
+        tile.lastUsedFrame = frame_;
+
+        if (tile.texture.id == 0) {
+            const Rectangle crop = {
+                static_cast<float>(tileX * tileSize_), static_cast<float>(tileY * tileSize_),
+                static_cast<float>(std::min(tileSize_, mip.image.width - tileX * tileSize_)),
+                static_cast<float>(std::min(tileSize_, mip.image.height - tileY * tileSize_))
+            };
+            const Image chunk = ImageFromImage(mip.image, crop);
+            tile.texture = LoadTextureFromImage(chunk);
+            UnloadImage(chunk);
+            residentTiles_++;
+        }
+        return tile.texture;
+    }
+
+    void TiledBackground::evictUnused() {
+        for (auto &mip : levels_) {
+            for (auto &tile : mip.tiles) {
+                if (tile.texture.id != 0 && frame_ - tile.lastUsedFrame > EVICT_AFTER_FRAMES) {
+                    UnloadTexture(tile.texture);
+                    tile.texture = {};
+                    residentTiles_--;
+                }
+            }
+        }
+    }
+
+    void TiledBackground::draw(const Rectangle &view, const float zoom) {
+        frame_++;
+        if (!acquireSource()) return;
+
+        // One mip level down every time zoom halves
+        const int level = std::clamp(static_cast<int>(std::floor(std::log2(1.f / std::max(zoom, 0.001f)))),
+                                     0, static_cast<int>(levels_.size()) - 1);
+        MipLevel &mip = getLevel(level);
+
+        // With parallax the background is shifted along with camera
+        const Vector2 shift = {
+            (view.x + view.width / 2) * (1 - parallax_),
+            (view.y + view.height / 2) * (1 - parallax_)
+        };
+        const Rectangle shiftedView = {view.x - shift.x, view.y - shift.y, view.width, view.height};
+        const Rectangle visible = GetCollisionRec(shiftedView, area_);
+        if (visible.width <= 0 || visible.height <= 0) {
+            evictUnused();
+            return;
+        }
+
+        // Level image covers the same world size as the source one
+        const auto periodWidth = static_cast<float>(source_.width);
+        const auto periodHeight = static_cast<float>(source_.height);
+        const float texelScale = periodWidth / static_cast<float>(mip.image.width);
+        const float tileWorld = static_cast<float>(tileSize_) * texelScale;
+
+        const int firstPeriodX = static_cast<int>(std::floor((visible.x - area_.x) / periodWidth));
+        const int firstPeriodY = static_cast<int>(std::floor((visible.y - area_.y) / periodHeight));
+        const int lastPeriodX = static_cast<int>(std::floor((visible.x + visible.width - area_.x) / periodWidth));
+        const int lastPeriodY = static_cast<int>(std::floor((visible.y + visible.height - area_.y) / periodHeight));
+
+        for (int py = firstPeriodY; py <= lastPeriodY; py++) {
+            for (int px = firstPeriodX; px <= lastPeriodX; px++) {
+                const Rectangle period = {area_.x + static_cast<float>(px) * periodWidth,
+                                          area_.y + static_cast<float>(py) * periodHeight,
+                                          periodWidth, periodHeight};
+                const Rectangle local = GetCollisionRec(period, visible);
+                if (local.width <= 0 || local.height <= 0) continue;
+
+                // Tiles do not have to divide the image - last one in a row is partial
+                const int firstX = static_cast<int>((local.x - period.x) / tileWorld);
+                const int firstY = static_cast<int>((local.y - period.y) / tileWorld);
+                const int lastX = std::min(static_cast<int>((local.x + local.width - period.x) / tileWorld),
+                                           mip.tilesX - 1);
+                const int lastY = std::min(static_cast<int>((local.y + local.height - period.y) / tileWorld),
+                                           mip.tilesY - 1);
+
+                for (int tileY = firstY; tileY <= lastY; tileY++) {
+                    for (int tileX = firstX; tileX <= lastX; tileX++) {
+                        const Rectangle tileRect = {
+                            period.x + static_cast<float>(tileX) * tileWorld,
+                            period.y + static_cast<float>(tileY) * tileWorld,
+                            std::min(tileWorld, periodWidth - static_cast<float>(tileX) * tileWorld),
+                            std::min(tileWorld, periodHeight - static_cast<float>(tileY) * tileWorld)
+                        };
+
+                        // Only the part inside world area is drawn
+                        const Rectangle clipped = GetCollisionRec(tileRect, area_);
+                        if (clipped.width <= 0 || clipped.height <= 0) continue;
+
+                        const Texture2D texture = getTile(mip, tileX, tileY);
+                        const Rectangle source = {
+                            (clipped.x - tileRect.x) / texelScale, (clipped.y - tileRect.y) / texelScale,
+                            clipped.width / texelScale, clipped.height / texelScale
+                        };
+                        const Rectangle dest = {clipped.x + shift.x, clipped.y + shift.y,
+                                                clipped.width, clipped.height};
+                        RenderQueue::Submit(texture, source, dest, {0, 0}, 0, WHITE, BACKGROUND);
+                    }
+                }
+            }
+        }
+
+        evictUnused();
+    }
+
+    void TiledBackground::unload() {
+        for (size_t level = 0; level < levels_.size(); level++) {
+            MipLevel &mip = levels_[level];
+            for (auto &tile : mip.tiles) {
+                if (tile.texture.id != 0)
+                    UnloadTexture(tile.texture);
+            }
+            // Level 0 image is the source one, unloaded below
+            if (level > 0 && mip.image.data != nullptr)
+                UnloadImage(mip.image);
+            mip = {};
+        }
+
+        if (source_.data != nullptr)
+            UnloadImage(source_);
+        source_ = {};
+        streaming::AssetStreamer::Release(sourceStream_);
+        sourceStream_ = streaming::INVALID_STREAM;
+        residentTiles_ = 0;
+    }
+}
@@ -0,0 +1,142 @@
+// Kept apart from raylib headers: winsock2.h clashes with raylib names
+
+#include "core/udpSocket.h"
+
+#include <cstdio>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace core::net {
+    namespace {
+#ifdef _WIN32
+        using SocketLength = int;
+
+        /// Winsock has to be started once per process before the first socket
+        bool startup() {
+            static const bool s_started = [] {
+                WSADATA data;
+                return WSAStartup(MAKEWORD(2, 2), &data) == 0;
+            }();
+            return s_started;
+        }
+
+        SOCKET native(const intptr_t handle) { return static_cast<SOCKET>(handle); }
+#else
+        using SocketLength = socklen_t;
+
+        bool startup() { return true; }
+
+        int native(const intptr_t handle) { return static_cast<int>(handle); }
+#endif
+
+        sockaddr_in toNative(const Address &address) {
+            sockaddr_in result {};
+            result.sin_family = AF_INET;
+            result.sin_addr.s_addr = htonl(address.host);
+            result.sin_port = htons(address.port);
+            return result;
+        }
+    }
+
+    bool parseAddress(const std::string &text, Address &out) {
+        unsigned int a, b, c, d, port;
+        char tail;
+        if (std::sscanf(text.c_str(), "%u.%u.%u.%u:%u%c", &a, &b, &c, &d, &port, &tail) != 5)
+            return false;
+        if (a > 255 || b > 255 || c > 255 || d > 255 || port == 0 || port > 65535)
+            return false;
+
+        out.host = a << 24 | b << 16 | c << 8 | d;
+        out.port = static_cast<uint16_t>(port);
+        return true;
+    }
+
+    bool UdpSocket::open(const uint16_t port) {
+        close();
+        if (!startup())
+            return false;
+
+        const auto handle = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+#ifdef _WIN32
+        if (handle == INVALID_SOCKET)
+            return false;
+#else
+        if (handle < 0)
+            return false;
+#endif
+        handle_ = static_cast<intptr_t>(handle);
+
+        const sockaddr_in address = toNative({INADDR_ANY, port});
+        if (bind(native(handle_), reinterpret_cast<const sockaddr *>(&address), sizeof(address)) != 0) {
+            close();
+            return false;
+        }
+
+#ifdef _WIN32
+        u_long nonBlocking = 1;
+        const bool ok = ioctlsocket(native(handle_), FIONBIO, &nonBlocking) == 0;
+#else
+        const bool ok = fcntl(native(handle_), F_SETFL, fcntl(native(handle_), F_GETFL) | O_NONBLOCK) == 0;
+#endif
+        if (!ok)
+            close();
+        return ok;
+    }
+
+    void UdpSocket::close() {
+        if (!isOpen())
+            return;
+#ifdef _WIN32
+        closesocket(native(handle_));
+#else
+        ::close(native(handle_));
+#endif
+        handle_ = -1;
+    }
+
+    uint16_t UdpSocket::getPort() const {
+        if (!isOpen())
+            return 0;
+        sockaddr_in address {};
+        SocketLength length = sizeof(address);
+        if (getsockname(native(handle_), reinterpret_cast<sockaddr *>(&address), &length) != 0)
+            return 0;
+        return ntohs(address.sin_port);
+    }
+
+    bool UdpSocket::send(const Address &to, const void *data, const size_t size) const {
+        if (!isOpen())
+            return false;
+        const sockaddr_in address = toNative(to);
+        const auto sent = sendto(native(handle_), static_cast<const char *>(data), static_cast<int>(size), 0,
+                                 reinterpret_cast<const sockaddr *>(&address), sizeof(address));
+        return sent >= 0 && static_cast<size_t>(sent) == size;
+    }
+
+    int UdpSocket::receive(void *buffer, const size_t capacity, Address &from) const {
+        if (!isOpen())
+            return -1;
+        sockaddr_in address {};
+        SocketLength length = sizeof(address);
+        // Datagrams longer than capacity are cut; protocol never sends those
+        const auto received = recvfrom(native(handle_), static_cast<char *>(buffer), static_cast<int>(capacity), 0,
+                                       reinterpret_cast<sockaddr *>(&address), &length);
+        if (received < 0)
+            return -1;
+
+        from.host = ntohl(address.sin_addr.s_addr);
+        from.port = ntohs(address.sin_port);
+        return static_cast<int>(received);
+    }
+}
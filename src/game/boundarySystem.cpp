@@ -0,0 +1,134 @@
+#include "game/boundarySystem.h"
+
+#include <cmath>
+
+#include "raymath.h"
+
+namespace game::world {
+    WorldBounds BoundarySystem::s_bounds;
+    std::unordered_map<std::type_index, BoundaryPolicy> BoundarySystem::s_policies;
+
+    std::vector<BoundarySystem::Body> BoundarySystem::s_bodies;
+    std::vector<float> BoundarySystem::s_posX;
+    std::vector<float> BoundarySystem::s_posY;
+    std::vector<uint8_t> BoundarySystem::s_outside;
+    uint64_t BoundarySystem::s_bodiesVersion = UINT64_MAX;
+
+    void BoundarySystem::ClearPolicies() {
+        s_policies.clear();
+        s_bodies.clear();
+        s_bodiesVersion = UINT64_MAX;
+    }
+
+    void BoundarySystem::rebuild() {
+        s_bodies.clear();
+        for (auto *object : game_objects::GameObject::s_allObjects) {
+            const auto it = s_policies.find(std::type_index(typeid(*object)));
+            if (it == s_policies.end() || it->second == BoundaryPolicy::NONE) continue;
+
+            s_bodies.push_back({object, dynamic_cast<game_objects::MovingObject*>(object),
+                                dynamic_cast<game_objects::CollidingObject*>(object), it->second});
+        }
+
+        s_posX.resize(s_bodies.size());
+        s_posY.resize(s_bodies.size());
+        s_outside.resize(s_bodies.size());
+        s_bodiesVersion = game_objects::GameObject::s_allObjectsVersion;
+    }
+
+    void BoundarySystem::testCircle(const size_t count) {
+        const float centerX = s_bounds.center.x;
+        const float centerY = s_bounds.center.y;
+        const float radiusSqr = s_bounds.radius * s_bounds.radius;
+
+        // Branchless, so compiler can vectorize it
+        for (size_t i = 0; i < count; i++) {
+            const float dx = s_posX[i] - centerX;
+            const float dy = s_posY[i] - centerY;
+            s_outside[i] = dx * dx + dy * dy > radiusSqr;
+        }
+    }
+
+    void BoundarySystem::testRect(const size_t count) {
+        const float left = s_bounds.rect.x;
+        const float top = s_bounds.rect.y;
+        const float right = left + s_bounds.rect.width;
+        const float bottom = top + s_bounds.rect.height;
+
+        for (size_t i = 0; i < count; i++) {
+            s_outside[i] = (s_posX[i] < left) | (s_posX[i] > right) | (s_posY[i] < top) | (s_posY[i] > bottom);
+        }
+    }
+
+    Vector2 BoundarySystem::outwardNormal(const Vector2 position) {
+        if (s_bounds.shape == WorldBounds::CIRCLE)
+            return Vector2Normalize(position - s_bounds.center);
+
+        const Rectangle &rect = s_bounds.rect;
+        Vector2 normal = {0, 0};
+        if (position.x < rect.x) normal.x = -1;
+        else if (position.x > rect.x + rect.width) normal.x = 1;
+        if (position.y < rect.y) normal.y = -1;
+        else if (position.y > rect.y + rect.height) normal.y = 1;
+        return Vector2Normalize(normal);
+    }
+
+    void BoundarySystem::apply(const Body &body, const Vector2 position) {
+        switch (body.policy) {
+            case BoundaryPolicy::REFLECT: {
+                if (!body.moving) return;
+                // Only while heading out, so an object already turned back is left alone
+                const Vector2 normal = outwardNormal(position);
+                if (Vector2DotProduct(body.moving->getVelocity(), normal) > 0)
+                    body.moving->bounceByNormal(normal);
+                return;
+            }
+            case BoundaryPolicy::WRAP: {
+                Vector2 wrapped;
+                if (s_bounds.shape == WorldBounds::CIRCLE) {
+                    // Re-enter from the opposite point of the circle
+                    wrapped = s_bounds.center - Vector2Normalize(position - s_bounds.center) * s_bounds.radius;
+                }
+                else {
+                    const Rectangle &rect = s_bounds.rect;
+                    wrapped = {
+                        rect.x + std::fmod(std::fmod(position.x - rect.x, rect.width) + rect.width, rect.width),
+                        rect.y + std::fmod(std::fmod(position.y - rect.y, rect.height) + rect.height, rect.height)
+                    };
+                }
+                body.object->getTransform().center = wrapped;
+                if (body.colliding)
+                    body.colliding->updateCollider();
+                return;
+            }
+            case BoundaryPolicy::DESPAWN:
+                body.object->destroy();
+                return;
+            case BoundaryPolicy::NONE:
+                return;
+        }
+    }
+
+    void BoundarySystem::Update() {
+        if (s_bounds.shape == WorldBounds::NONE) return;
+        if (s_bodiesVersion != game_objects::GameObject::s_allObjectsVersion)
+            rebuild();
+
+        const size_t count = s_bodies.size();
+        for (size_t i = 0; i < count; i++) {
+            const Vector2 center = s_bodies[i].object->getTransform().center;
+            s_posX[i] = center.x;
+            s_posY[i] = center.y;
+        }
+
+        if (s_bounds.shape == WorldBounds::CIRCLE)
+            testCircle(count);
+        else
+            testRect(count);
+
+        for (size_t i = 0; i < count; i++) {
+            if (!s_outside[i] || !s_bodies[i].object->isActive()) continue;
+            apply(s_bodies[i], {s_posX[i], s_posY[i]});
+        }
+    }
+}
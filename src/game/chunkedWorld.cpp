@@ -0,0 +1,291 @@
+#include "game/chunkedWorld.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <numbers>
+
+#include "assetManifest.h"
+#include "core/textureAtlas.h"
+#include "game/gameObjectManager.h"
+#include "game/entities/units.h"
+
+namespace game::world {
+    namespace {
+        constexpr float c_asteroidSpeedLimit = 1000;
+        constexpr float c_positionStep = ChunkedWorld::CHUNK_SIZE / 65535.f;
+
+        /// xorshift32 seeded by chunk coordinates, so chunk content depends only on world
+        /// seed and where the chunk is, never on the order chunks were visited in
+        class ChunkRandom {
+            uint32_t state_;
+        public:
+            ChunkRandom(const uint32_t seed, const int x, const int y) {
+                uint32_t hash = seed ^ static_cast<uint32_t>(x) * 0x9E3779B1u ^ static_cast<uint32_t>(y) * 0x85EBCA77u;
+                // Murmur3 finalizer spreads neighbouring coordinates apart
+                hash ^= hash >> 16;
+                hash *= 0x85EBCA6Bu;
+                hash ^= hash >> 13;
+                hash *= 0xC2B2AE35u;
+                hash ^= hash >> 16;
+                state_ = hash != 0 ? hash : 1;
+            }
+
+            uint32_t next() {
+                state_ ^= state_ << 13;
+                state_ ^= state_ >> 17;
+                state_ ^= state_ << 5;
+                return state_;
+            }
+
+            int range(const int min, const int max) {
+                return min + static_cast<int>(next() % static_cast<uint32_t>(max - min + 1));
+            }
+
+            /// Uniform in [0, 1)
+            float unit() {
+                return static_cast<float>(next() >> 8) / static_cast<float>(1 << 24);
+            }
+        };
+    }
+
+    uint64_t ChunkedWorld::keyOf(const int x, const int y) {
+        return static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32 | static_cast<uint32_t>(y);
+    }
+
+    ChunkedWorld::ChunkCoord ChunkedWorld::coordOf(const Vector2 position) {
+        return {static_cast<int>(std::floor(position.x / CHUNK_SIZE)),
+                static_cast<int>(std::floor(position.y / CHUNK_SIZE))};
+    }
+
+    Vector2 ChunkedWorld::cornerOf(const ChunkCoord coord) {
+        return {static_cast<float>(coord.x) * CHUNK_SIZE, static_cast<float>(coord.y) * CHUNK_SIZE};
+    }
+
+    ChunkedWorld::Chunk &ChunkedWorld::getChunk(const ChunkCoord coord) {
+        const auto [it, inserted] = chunks_.try_emplace(keyOf(coord.x, coord.y));
+        if (inserted) {
+            generate(coord, it->second.records);
+            recordCount_ += it->second.records.size();
+        }
+        return it->second;
+    }
+
+    void ChunkedWorld::generate(const ChunkCoord coord, std::vector<AsteroidRecord> &out) const {
+        ChunkRandom random(seed_, coord.x, coord.y);
+        const Vector2 corner = cornerOf(coord);
+        constexpr float cell = CHUNK_SIZE / CELLS_PER_CHUNK;
+
+        // Jittered grid: a rock stays inside its cell, so rocks never overlap
+        for (int cellY = 0; cellY < CELLS_PER_CHUNK; cellY++) {
+            for (int cellX = 0; cellX < CELLS_PER_CHUNK; cellX++) {
+                if (random.range(0, 99) >= ASTEROID_CHANCE_PERCENT) continue;
+
+                const int size = random.range(params_.minSize, params_.maxSize);
+                const float radius = static_cast<float>(size) / 2;
+                const Vector2 local = {
+                    static_cast<float>(cellX) * cell + radius + random.unit() * (cell - static_cast<float>(size)),
+                    static_cast<float>(cellY) * cell + radius + random.unit() * (cell - static_cast<float>(size))
+                };
+                const auto speed = static_cast<float>(random.range(params_.minSpeed, params_.maxSpeed));
+                const float angle = 2 * std::numbers::pi_v<float> * random.unit();
+
+                // Everything is drawn before this check, so the rest of chunk does not depend on it
+                const Vector2 position = {corner.x + local.x, corner.y + local.y};
+                if (Vector2Distance(position, safeCenter_) < safeRadius_ + radius) continue;
+
+                out.push_back({
+                    static_cast<uint16_t>(local.x / c_positionStep),
+                    static_cast<uint16_t>(local.y / c_positionStep),
+                    static_cast<int16_t>(std::cos(angle) * speed),
+                    static_cast<int16_t>(std::sin(angle) * speed),
+                    static_cast<uint8_t>(size),
+                    static_cast<uint8_t>(std::clamp(params_.hp, 1, 255))
+                });
+            }
+        }
+    }
+
+    std::shared_ptr<game_objects::Asteroid> ChunkedWorld::acquire(const components::Transform2D &transform, const int hp) {
+        std::shared_ptr<game_objects::Asteroid> asteroid = pool_.acquire();
+        if (!asteroid) {
+            asteroid = management::GameObjectManager::getInstance().createObject<game_objects::Asteroid>(
+                transform, hp, c_asteroidSpeedLimit);
+            asteroid->SetTexture(core::atlas::TextureAtlas::Get(assets::TextureId::ASTEROID));
+        }
+        return asteroid;
+    }
+
+    void ChunkedWorld::spawn(const ChunkCoord coord, const AsteroidRecord &record) {
+        const Vector2 corner = cornerOf(coord);
+        const auto size = static_cast<float>(record.size);
+        const components::Transform2D transform(corner.x + record.x * c_positionStep,
+                                                corner.y + record.y * c_positionStep, size, size);
+
+        std::shared_ptr<game_objects::Asteroid> asteroid = acquire(transform, record.hp);
+        asteroid->respawn(transform, record.hp, {static_cast<float>(record.velocityX),
+                                                 static_cast<float>(record.velocityY)});
+        live_.push_back(std::move(asteroid));
+    }
+
+    void ChunkedWorld::freeze(const std::shared_ptr<game_objects::Asteroid> &asteroid, const ChunkCoord coord) {
+        Chunk &chunk = getChunk(coord);
+        const components::Transform2D &transform = asteroid->getTransform();
+        const Vector2 local = transform.center - cornerOf(coord);
+        const Vector2 velocity = asteroid->getVelocity();
+
+        chunk.records.push_back({
+            static_cast<uint16_t>(std::clamp(local.x / c_positionStep, 0.f, 65535.f)),
+            static_cast<uint16_t>(std::clamp(local.y / c_positionStep, 0.f, 65535.f)),
+            static_cast<int16_t>(std::clamp(velocity.x, -32767.f, 32767.f)),
+            static_cast<int16_t>(std::clamp(velocity.y, -32767.f, 32767.f)),
+            static_cast<uint8_t>(std::clamp(transform.size.x, 1.f, 255.f)),
+            static_cast<uint8_t>(std::clamp(asteroid->getHp(), 1, 255))
+        });
+        recordCount_++;
+
+        asteroid->setActive(false);
+        pool_.release(asteroid);
+    }
+
+    void ChunkedWorld::activate(const ChunkCoord coord) {
+        Chunk &chunk = getChunk(coord);
+        chunk.active = true;
+        active_.push_back(coord);
+
+        for (const auto &record : chunk.records)
+            spawn(coord, record);
+        recordCount_ -= chunk.records.size();
+        // Live chunk owns no records - free them, not just clear
+        chunk.records = {};
+    }
+
+    void ChunkedWorld::releaseLive() {
+        for (const auto &asteroid : live_) {
+            asteroid->setActive(false);
+            pool_.release(asteroid);
+        }
+        live_.clear();
+    }
+
+    void ChunkedWorld::reset(const uint32_t seed, const Vector2 safeCenter, const float safeRadius) {
+        releaseLive();
+        chunks_.clear();
+        active_.clear();
+        recordCount_ = 0;
+
+        seed_ = seed;
+        safeCenter_ = safeCenter;
+        safeRadius_ = safeRadius;
+    }
+
+    void ChunkedWorld::update(const Vector2 focus) {
+        const ChunkCoord center = coordOf(focus);
+
+        // Far chunks go first, their asteroids are frozen by the sweep below
+        std::erase_if(active_, [&](const ChunkCoord &coord) {
+            if (std::max(std::abs(coord.x - center.x), std::abs(coord.y - center.y)) <= KEEP_RADIUS)
+                return false;
+            chunks_[keyOf(coord.x, coord.y)].active = false;
+            return true;
+        });
+
+        for (int y = center.y - ACTIVE_RADIUS; y <= center.y + ACTIVE_RADIUS; y++) {
+            for (int x = center.x - ACTIVE_RADIUS; x <= center.x + ACTIVE_RADIUS; x++) {
+                if (!getChunk({x, y}).active)
+                    activate({x, y});
+            }
+        }
+
+        // Asteroids left in deactivated chunks or drifting out of active ones
+        for (size_t i = 0; i < live_.size();) {
+            const auto &asteroid = live_[i];
+            if (!asteroid->isActive()) {  // Destroyed: collectDestroyed counts it
+                i++;
+                continue;
+            }
+
+            const ChunkCoord coord = coordOf(asteroid->getTransform().center);
+            if (getChunk(coord).active) {
+                i++;
+                continue;
+            }
+
+            freeze(asteroid, coord);
+            live_[i] = std::move(live_.back());
+            live_.pop_back();
+        }
+    }
+
+    int ChunkedWorld::collectDestroyed() {
+        int destroyed = 0;
+        std::erase_if(live_, [&](const std::shared_ptr<game_objects::Asteroid> &asteroid) {
+            if (asteroid->isActive())
+                return false;
+            pool_.release(asteroid);
+            destroyed++;
+            return true;
+        });
+        return destroyed;
+    }
+
+    void ChunkedWorld::saveState(core::snapshot::SnapshotWriter &writer) const {
+        writer.write(seed_);
+        writer.write(safeCenter_);
+        writer.write(safeRadius_);
+
+        // By key, so equal worlds make equal blobs whatever order their chunks were made in
+        std::vector<const std::pair<const uint64_t, Chunk>*> chunks;
+        chunks.reserve(chunks_.size());
+        for (const auto &entry : chunks_)
+            chunks.push_back(&entry);
+        std::ranges::sort(chunks, {}, [](const auto *entry) { return entry->first; });
+
+        writer.write(static_cast<uint64_t>(chunks.size()));
+        for (const auto *entry : chunks) {
+            writer.write(entry->first);
+            writer.write(entry->second.active);
+            writer.writeVector(entry->second.records);
+        }
+        writer.writeVector(active_);
+
+        writer.write(static_cast<uint64_t>(live_.size()));
+        for (const auto &asteroid : live_)
+            writer.write(asteroid->getState());
+    }
+
+    bool ChunkedWorld::loadState(core::snapshot::SnapshotReader &reader) {
+        releaseLive();
+        chunks_.clear();
+        recordCount_ = 0;
+
+        reader.read(seed_);
+        reader.read(safeCenter_);
+        reader.read(safeRadius_);
+
+        uint64_t chunkCount = 0;
+        reader.read(chunkCount);
+        for (uint64_t i = 0; i < chunkCount && !reader.failed(); i++) {
+            uint64_t key = 0;
+            Chunk chunk;
+            reader.read(key);
+            reader.read(chunk.active);
+            reader.readVector(chunk.records);
+            recordCount_ += chunk.records.size();
+            chunks_.emplace(key, std::move(chunk));
+        }
+        reader.readVector(active_);
+
+        uint64_t liveCount = 0;
+        reader.read(liveCount);
+        for (uint64_t i = 0; i < liveCount; i++) {
+            game_objects::AsteroidState state;
+            if (!reader.read(state))
+                break;
+            std::shared_ptr<game_objects::Asteroid> asteroid = acquire(state.transform, state.unit.hp.getValue());
+            asteroid->setState(state);
+            live_.push_back(std::move(asteroid));
+        }
+        return !reader.failed();
+    }
+}
@@ -6,11 +6,14 @@
 #include <raymath.h>
 #include <vector>
 
+#include "game/gameLoop.h"
 #include "game/gameObjectManager.h"
 #include "game/gameObjects.h"
-#include "game/entities/bullet.h"
+#include "game/projectileSystem.h"
 #include "game/entities/player.h"
 #include "core/animation.h"
+#include "core/input.h"
+#include "core/particleSystem.h"
 
 #include <iostream>
 
@@ -19,6 +22,9 @@ constexpr int c_acceleration = 500;
 constexpr int c_rotation = 10;
 
 constexpr float c_shootTimeOut = 0.5;
+constexpr float c_bulletSpeed = 300;
+constexpr float c_bulletRadius = 5;
+constexpr int c_bulletDamage = 10;
 constexpr float c_dashTimeOut = 4;
 constexpr float c_dashTime = 0.5;
 constexpr float c_dashInvincibilityTime = 0.5;
@@ -28,6 +34,24 @@ constexpr float c_afterContactControlBlockTime = 0.2;
 constexpr float c_damageInvincibilityTime = 1.5;
 constexpr float c_damageImpulse = 0.5;
 
+const core::particles::ParticleParams c_thrusterParticles {
+    .color = ORANGE, .minSpeed = 80, .maxSpeed = 160, .minLife = 0.15f, .maxLife = 0.35f,
+    .minSize = 2, .maxSize = 4, .spread = 0.5f, .drag = 0.2f
+};
+constexpr float c_thrusterRate = 120;
+
+const core::particles::ParticleParams c_dashTrailParticles {
+    .color = SKYBLUE, .minSpeed = 0, .maxSpeed = 20, .minLife = 0.3f, .maxLife = 0.5f,
+    .minSize = 3, .maxSize = 6, .spread = 2 * PI, .drag = 0.1f
+};
+constexpr float c_dashTrailRate = 200;
+
+const core::particles::ParticleParams c_damageParticles {
+    .color = RED, .minSpeed = 100, .maxSpeed = 250, .minLife = 0.2f, .maxLife = 0.5f,
+    .minSize = 2, .maxSize = 4, .spread = 2 * PI, .drag = 0.1f
+};
+constexpr int c_damageParticlesCount = 150;
+
 namespace game::game_objects {
     std::vector<Vector2> Player::getVertices() const {
         return {
@@ -39,6 +63,75 @@ namespace game::game_objects {
 
     Player *Player::s_instance;
 
+    Player::~Player() {
+        core::particles::ParticleSystem::DestroyEmitter(thrusterEmitter_);
+        core::particles::ParticleSystem::DestroyEmitter(dashTrailEmitter_);
+        if (s_instance == this)
+            s_instance = nullptr;
+    }
+
+    PlayerState Player::getState() const {
+        return {
+            .transform = transform_,
+            .velocity = currentSpeed_,
+            .accelerationDirection = accelerationDirection,
+            .acceleration = acceleration_,
+            .maxSpeed = maxSpeed_,
+            .angle = angle_,
+            .rotationSpeed = currentRotationSpeed_,
+            .rotationAcceleration = rotationAcceleration_,
+            .verticesOffsets = {verticesOffsets[0], verticesOffsets[1], verticesOffsets[2]},
+            .shootTimeOut = shootTimeOut,
+            .dashTimeOut = dashTimeOut,
+            .dashingTime = dashingTime_,
+            .dashInvincibilityTime = dashInvincibilityTime_,
+            .damageInvincibilityTime = damageInvincibilityTime_,
+            .cantControlTime = cantControlTime_,
+            .unit = getUnitState()
+        };
+    }
+
+    void Player::setState(const PlayerState &state) {
+        transform_ = state.transform;
+        currentSpeed_ = state.velocity;
+        accelerationDirection = state.accelerationDirection;
+        acceleration_ = state.acceleration;
+        maxSpeed_ = state.maxSpeed;
+        angle_ = state.angle;
+        currentRotationSpeed_ = state.rotationSpeed;
+        rotationAcceleration_ = state.rotationAcceleration;
+        verticesOffsets.assign(state.verticesOffsets.begin(), state.verticesOffsets.end());
+
+        shootTimeOut = state.shootTimeOut;
+        dashTimeOut = state.dashTimeOut;
+        dashingTime_ = state.dashingTime;
+        dashInvincibilityTime_ = state.dashInvincibilityTime;
+        damageInvincibilityTime_ = state.damageInvincibilityTime;
+        cantControlTime_ = state.cantControlTime;
+
+        // Collider was built around the origin, same as verticesOffsets
+        static_cast<components::ColliderPoly*>(collider)->setOffsets(verticesOffsets);
+        updateCollider();
+        setUnitState(state.unit);
+    }
+
+    void Player::createEmitters() {
+        thrusterEmitter_ = core::particles::ParticleSystem::CreateEmitter(c_thrusterParticles, c_thrusterRate);
+        dashTrailEmitter_ = core::particles::ParticleSystem::CreateEmitter(c_dashTrailParticles, c_dashTrailRate);
+    }
+
+    void Player::updateEmitters(const bool thrusting) {
+        const auto vertices = getVertices();
+        const Vector2 tail = (vertices[0] + vertices[1]) / 2;
+        const Vector2 backward = Vector2Negate(Vector2Normalize(verticesOffsets[2]));
+
+        core::particles::ParticleSystem::SetEmitterTransform(thrusterEmitter_, tail, backward);
+        core::particles::ParticleSystem::SetEmitterActive(thrusterEmitter_, thrusting);
+
+        core::particles::ParticleSystem::SetEmitterTransform(dashTrailEmitter_, transform_.center, backward);
+        core::particles::ParticleSystem::SetEmitterActive(dashTrailEmitter_, isDashing());
+    }
+
     void Player::physUpdate(const float deltaTime) {
         Unit::physUpdate(deltaTime);
 
@@ -72,15 +165,19 @@ namespace game::game_objects {
     }
 
     void Player::logicUpdate() {
+        using core::input::Input;
+        // Logic runs on simulation thread, raylib's GetFrameTime belongs to the window one
+        const float deltaTime = loop::getFrameTime();
+
     #pragma region movement
         auto getNoseDirection = [this] {
             return Vector2Normalize(verticesOffsets[2]);
         };
 
-        auto isPressedUp = [] { return IsKeyDown(KEY_UP) or IsKeyDown(KEY_W); };
-        auto isPressedDown = [] { return IsKeyDown(KEY_DOWN) or IsKeyDown(KEY_S); };
-        auto isPressedLeft = [] { return IsKeyDown(KEY_LEFT) or IsKeyDown(KEY_A); };
-        auto isPressedRight = [] { return IsKeyDown(KEY_RIGHT) or IsKeyDown(KEY_D); };
+        auto isPressedUp = [] { return Input::IsKeyDown(KEY_UP) or Input::IsKeyDown(KEY_W); };
+        auto isPressedDown = [] { return Input::IsKeyDown(KEY_DOWN) or Input::IsKeyDown(KEY_S); };
+        auto isPressedLeft = [] { return Input::IsKeyDown(KEY_LEFT) or Input::IsKeyDown(KEY_A); };
+        auto isPressedRight = [] { return Input::IsKeyDown(KEY_RIGHT) or Input::IsKeyDown(KEY_D); };
 
         if (!(isPressedUp() or isPressedDown()) and canControl()) {
             acceleration_ = 0;
@@ -113,21 +210,21 @@ namespace game::game_objects {
             rotationAcceleration_ = -c_rotation;
         }
 
-        if (IsKeyDown(KEY_LEFT_CONTROL) or IsKeyDown(KEY_RIGHT_CONTROL)) {  // Control allowed always
+        if (Input::IsKeyDown(KEY_LEFT_CONTROL) or Input::IsKeyDown(KEY_RIGHT_CONTROL)) {  // Control allowed always
             accelerationDirection = Vector2Normalize(Vector2Negate(currentSpeed_));
             acceleration_ = c_acceleration;
         }
     #pragma endregion
 
         // Shoot
-        if (canShoot() and (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) or IsKeyDown(KEY_J))) {
-            management::GameObjectManager::getInstance().createObject<Bullet>(
-        components::Transform2D(getVertices()[2].x, getVertices()[2].y, 10, 10), 300, angle_);
+        if (canShoot() and (Input::IsMouseButtonPressed(MOUSE_LEFT_BUTTON) or Input::IsKeyDown(KEY_J))) {
+            projectiles::ProjectileSystem::Spawn(getVertices()[2], {c_bulletSpeed * cosf(angle_), c_bulletSpeed * sinf(angle_)},
+                                                 c_bulletRadius, c_bulletDamage);
             shootTimeOut = c_shootTimeOut;
         }
 
         // Dash
-        if (IsKeyPressed(KEY_SPACE) and canDash()) {
+        if (Input::IsKeyPressed(KEY_SPACE) and canDash()) {
             Vector2 direction = {0, 0};
             bool hasInput = false;
             const Vector2 noseDir = getNoseDirection(); // Store once to avoid repeated calls
@@ -157,19 +254,21 @@ namespace game::game_objects {
             dash(Vector2Normalize(direction), maxSpeed_ * 1.5);
         }
 
+        updateEmitters(isPressedUp() and canControl());
+
         // Timers
         if (dashInvincibilityTime_ > 0)
-            dashInvincibilityTime_ -= GetFrameTime();
+            dashInvincibilityTime_ -= deltaTime;
         if (damageInvincibilityTime_ > 0)
-            damageInvincibilityTime_ -= GetFrameTime();
+            damageInvincibilityTime_ -= deltaTime;
         if (shootTimeOut > 0)
-            shootTimeOut -= GetFrameTime();
+            shootTimeOut -= deltaTime;
         if (dashTimeOut > 0)
-            dashTimeOut -= GetFrameTime();
+            dashTimeOut -= deltaTime;
         if (cantControlTime_ > 0)
-            cantControlTime_ -= GetFrameTime();
+            cantControlTime_ -= deltaTime;
         if (dashingTime_ > 0) {
-            dashingTime_ -= GetFrameTime();
+            dashingTime_ -= deltaTime;
         }
         else if (maxSpeed_ > maxSpeedDashless_) {
             maxSpeed_ -= 20;
@@ -183,6 +282,7 @@ namespace game::game_objects {
 
         // hp_.ChangeValue(-value);
         Unit::takeDamage(value);
+        core::particles::ParticleSystem::Burst(transform_.center, c_damageParticlesCount, c_damageParticles);
 
         if (isDead()) {
             // Create explosion transform at player position
@@ -190,7 +290,7 @@ namespace game::game_objects {
             explosionTransform.size *= 3; // Larger size for visibility
 
             // Play explosion animation
-            core::animation::AnimationSystem::Play("playerExplosion", explosionTransform);
+            core::animation::AnimationSystem::Play(assets::AnimationId::PLAYER_EXPLOSION, explosionTransform);
         }
         dashInvincibilityTime_ = c_damageInvincibilityTime;
     }
@@ -220,7 +320,7 @@ namespace game::game_objects {
         const auto vertices = getVertices();
 
         if (texture) {
-            texture->Draw(getTransform(), Player::angle_ / acosf(-1) * 180);
+            texture->Draw(getTransform(), Player::angle_ / acosf(-1) * 180, getWorldLayer());
             if (!isInvincible()) {
                 texture->SetTint(GREEN);
                 //DrawTriangle(vertices[1], vertices[0], vertices[2], GREEN);
@@ -249,4 +349,8 @@ namespace game::game_objects {
     void Player::LoadTexture(const char* path) {
         texture = std::make_unique<components::TextureComponent>(path);
     }
+
+    void Player::SetTexture(const core::atlas::AtlasRegion& region) {
+        texture = std::make_unique<components::TextureComponent>(region);
+    }
 }
@@ -5,14 +5,33 @@
 #include "game//gameObjects.h"
 #include "game/entities/units.h"
 #include "core/animation.h"
+#include "core/particleSystem.h"
 #include "game/entities/player.h"
 
+const core::particles::ParticleParams c_asteroidDebrisParticles {
+    .color = BROWN, .minSpeed = 40, .maxSpeed = 200, .minLife = 0.4f, .maxLife = 1.2f,
+    .minSize = 2, .maxSize = 6, .spread = 2 * PI, .drag = 0.4f
+};
+constexpr int c_asteroidDebrisPerSize = 30;  // Per 10 units of asteroid size
+
 namespace game::game_objects {
     void Unit::die() {
         dead_ = true;
         setActive(false);
     }
 
+    void Unit::revive(const int hp) {
+        hp_ = stats::Stat(hp);
+        dead_ = false;
+        setActive(true);
+    }
+
+    void Unit::setUnitState(const UnitState &state) {
+        hp_ = state.hp;
+        dead_ = state.dead;
+        setActive(!state.dead);
+    }
+
     void Unit::takeDamage(const int value) {
         hp_.ChangeValue(-value);
 
@@ -31,10 +50,30 @@ namespace game::game_objects {
             explosionTransform.size *= 3; // Larger size for visibility
 
             // Play explosion animation
-            core::animation::AnimationSystem::Play("asteroidExplosion", explosionTransform);
+            core::animation::AnimationSystem::Play(assets::AnimationId::ASTEROID_EXPLOSION, explosionTransform);
+            core::particles::ParticleSystem::Burst(
+                transform_.center,
+                static_cast<int>(transform_.scaledSize().x / 10) * c_asteroidDebrisPerSize,
+                c_asteroidDebrisParticles);
         }
     }
 
+    void Asteroid::respawn(const components::Transform2D &tr, const int hp, const Vector2 velocity) {
+        transform_ = tr;
+        static_cast<components::ColliderCircle*>(collider)->setRadius(tr);
+        updateCollider();
+        currentSpeed_ = velocity;
+        revive(hp);
+    }
+
+    void Asteroid::setState(const AsteroidState &state) {
+        transform_ = state.transform;
+        static_cast<components::ColliderCircle*>(collider)->setRadius(state.transform);
+        updateCollider();
+        currentSpeed_ = state.velocity;
+        setUnitState(state.unit);
+    }
+
     void Asteroid::draw() {
         if (!isActive()) return;
        
@@ -45,7 +84,7 @@ namespace game::game_objects {
         DrawCircleLines(static_cast<int>(transform_.center.x),
                    static_cast<int>(transform_.center.y),
                    transform_.scaledSize().x / 2, BLACK);*/
-        texture->Draw(getTransform(), 0);
+        texture->Draw(getTransform(), 0, getWorldLayer());
     }
 
     void Asteroid::onCollided(CollidingObject *other) {
@@ -62,4 +101,8 @@ namespace game::game_objects {
     void Asteroid::LoadTexture(const char* path) {
         texture = std::make_unique<components::TextureComponent>(path);
     }
+
+    void Asteroid::SetTexture(const core::atlas::AtlasRegion& region) {
+        texture = std::make_unique<components::TextureComponent>(region);
+    }
 }
@@ -0,0 +1,93 @@
+#include "game/gameLoop.h"
+
+#include "core/allocationTracker.h"
+#include "core/animation.h"
+#include "core/particleSystem.h"
+#include "core/profiler.h"
+#include "game/boundarySystem.h"
+#include "game/gameObjectManager.h"
+#include "game/gameObjects.h"
+#include "game/physicsWorld.h"
+#include "game/projectileSystem.h"
+
+namespace game::loop {
+    namespace {
+        /// Frame time not yet consumed by physics steps
+        float s_physicsAccumulator = 0;
+        float s_frameTime = 0;
+    }
+
+    void updatePhysics() {
+        ALLOCATION_SCOPE(PHYSICS);
+        {
+            PROFILE_ZONE("Physics step");
+            physics::PhysicsWorld::Step(DELTA_TIME_PHYS);
+        }
+        {
+            PROFILE_ZONE("Projectiles");
+            projectiles::ProjectileSystem::Update(DELTA_TIME_PHYS);
+        }
+    }
+
+    void updateSimulation(const float frameTime) {
+        s_frameTime = frameTime;
+        {
+            ALLOCATION_SCOPE(EFFECTS);
+            PROFILE_ZONE("Animation");
+            core::animation::AnimationSystem::Update(frameTime);
+        }
+        {
+            ALLOCATION_SCOPE(EFFECTS);
+            PROFILE_ZONE("Particles");
+            core::particles::ParticleSystem::Update(frameTime);
+        }
+
+        // Physics update
+        s_physicsAccumulator += frameTime;
+        bool stepped = false;
+        while (s_physicsAccumulator > DELTA_TIME_PHYS) {
+            updatePhysics();
+            s_physicsAccumulator -= DELTA_TIME_PHYS;
+            stepped = true;
+        }
+        // Logic may query physics world even on frames too short for a step
+        if (!stepped) {
+            ALLOCATION_SCOPE(PHYSICS);
+            physics::PhysicsWorld::Sync();
+        }
+
+        {
+            ALLOCATION_SCOPE(PHYSICS);
+            PROFILE_ZONE("Boundaries");
+            world::BoundarySystem::Update();
+        }
+
+        // Logic
+        ALLOCATION_SCOPE(LOGIC);
+        PROFILE_ZONE("Logic");
+        for (const auto& gameObject : management::GameObjectManager::getAllObjects()) {
+            if (!gameObject->isActive()) continue;
+            gameObject->logicUpdate();
+        }
+    }
+
+    float getFrameTime() {
+        return s_frameTime;
+    }
+
+    void cleanup() {
+        ALLOCATION_SCOPE(LOGIC);
+        PROFILE_ZONE("Cleanup");
+        // Broad-phase holds raw pointers to objects about to be freed
+        physics::PhysicsWorld::Clear();
+        management::GameObjectManager::getInstance().destroyObjectsToDestroy();
+    }
+
+    void saveState(core::snapshot::SnapshotWriter &writer) {
+        writer.write(s_physicsAccumulator);
+    }
+
+    bool loadState(core::snapshot::SnapshotReader &reader) {
+        return reader.read(s_physicsAccumulator);
+    }
+}
@@ -4,7 +4,11 @@
 
 #include "game/gameObjects.h"
 
+#include <algorithm>
+#include <numbers>
 
+
+#include "core/physicsStats.h"
 #include "game/entities/units.h"
 
 
@@ -20,6 +24,7 @@ namespace game::game_objects {
 
     std::unordered_set<int> GameObject::s_existing_ids;
     std::list<GameObject*> GameObject::s_allObjects;
+    uint64_t GameObject::s_allObjectsVersion = 0;
 
     GameObject::GameObject(const components::Transform2D &tr): transform_(tr) {
         if (s_existing_ids.size() >= std::numeric_limits<int>::max() - 1)
@@ -29,6 +34,7 @@ namespace game::game_objects {
 
         s_existing_ids.insert(id_);
         s_allObjects.push_back(this);
+        s_allObjectsVersion++;
     }
 
     GameObject::GameObject(const GameObject& other):
@@ -38,6 +44,7 @@ namespace game::game_objects {
     GameObject::~GameObject() {
         s_existing_ids.erase(id_);
         s_allObjects.remove(this);
+        s_allObjectsVersion++;
     }
 
     GameObject* GameObject::instantiate(GameObject *gameObject) {
@@ -58,13 +65,15 @@ namespace game::game_objects {
     void CollidingObject::resolveCollision(CollidingObject &other) {
         const auto collisionNormal = collider->
                 getCollisionNormal(*other.collider);
-        for (int tries = 0; tries < 1000 and collider->checkCollision(*other.collider); tries++) {
+        int tries = 0;
+        for (; tries < 1000 and collider->checkCollision(*other.collider); tries++) {
             transform_.center -= collisionNormal * 0.1;
             other.transform_.center += collisionNormal * 0.1;
 
             updateCollider();
             other.updateCollider();
         }
+        PHYSICS_COUNT(stats.pushApartSteps.add(tries));
     }
 
     void CollidingObject::physUpdate(float deltaTime) {
@@ -76,6 +85,14 @@ namespace game::game_objects {
 
     MovingObject::~MovingObject() { GameObject::~GameObject(); }
 
+    Rectangle DrawnGameObject::getDrawBounds() {
+        // Square around rotated sprite, so angle does not matter
+        const Vector2 size = transform_.scaledSize();
+        const float halfExtent = std::max(size.x, size.y) * 0.5f * std::numbers::sqrt2_v<float>;
+        return {transform_.center.x - halfExtent, transform_.center.y - halfExtent,
+                2 * halfExtent, 2 * halfExtent};
+    }
+
     void MovingObject::bounceByNormal(const Vector2 normal) {
         const auto mirrored = Vector2Normalize(normal) * Vector2DotProduct(
                                   currentSpeed_, Vector2Normalize(normal));
@@ -4,19 +4,35 @@
 
 #include "game/levelManager.h"
 
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+#include "core/animation.h"
+#include "core/particleSystem.h"
+#include "core/poissonDisk.h"
+#include "game/boundarySystem.h"
+#include "game/gameLoop.h"
+#include "game/projectileSystem.h"
+
 namespace game::management {
+    namespace {
+        constexpr uint32_t c_snapshotMagic = assets::fnv1a("level snapshot");
+        /// Bump when anything written to snapshot changes
+        constexpr uint32_t c_snapshotVersion = 1;
+    }
+
     void LevelManager::startLevel() {
         const auto player = game_objects::Player::SpawnPlayer(
             components::Transform2D(WORLD_CENTER, {50, 50}), 10, 300, 3);
-        player->LoadTexture(textures::playerTexture.c_str());
+        player->SetTexture(core::atlas::TextureAtlas::Get(assets::TextureId::PLAYER));
         manager.registerExternalObject(game_objects::Player::GetInstance());
 
-        preferredAsteroidsCount = 15;
-        spawnAsteroids(preferredAsteroidsCount);
-        core::button::ButtonSystem::Load(
-            "restart",
-            textures::restartButtonTexture.c_str(),
-            {3, 1},
+        constexpr auto& buttonSheet = assets::info(assets::TextureId::RESTART_BUTTON);
+        restartButton = core::button::ButtonSystem::Load(
+            RESTART_BUTTON_ID,
+            core::atlas::TextureAtlas::Get(assets::TextureId::RESTART_BUTTON),
+            {buttonSheet.rows, buttonSheet.columns},
             Rectangle{ player->getTransform().corner().x - 90, player->getTransform().corner().y - 40, 180, 80},
             [this]() {
                 // ������ �������� ����
@@ -24,65 +40,159 @@ namespace game::management {
                 restart();
             }
         );
+
+        if (settings.mode == WorldMode::SECTORS) {
+            // Space is open: shots expire by lifetime, asteroids come from chunks
+            chunkedWorld.reset(static_cast<uint32_t>(GetRandomValue(0, INT_MAX)), player->getTransform().center,
+                               SAFE_SPAWN_DISTANCE + MAX_ASTEROID_SIZE);
+            chunkedWorld.update(player->getTransform().center);
+            projectiles::ProjectileSystem::SetBounds(WORLD_CENTER, INFINITY);
+            world::BoundarySystem::SetBounds({});
+            return;
+        }
+
+        preferredAsteroidsCount = settings.asteroidCount;
+        spawnAsteroids(preferredAsteroidsCount);
         setWorldBorders();
+        projectiles::ProjectileSystem::SetBounds(WORLD_CENTER, settings.worldRadius);
+        world::BoundarySystem::SetBounds(world::WorldBounds::Circle(WORLD_CENTER, settings.worldRadius));
+        world::BoundarySystem::SetPolicy<game_objects::Asteroid>(world::BoundaryPolicy::REFLECT);
+        world::BoundarySystem::SetPolicy<game_objects::Player>(world::BoundaryPolicy::REFLECT);
     }
 
     void LevelManager::spawnAsteroids(const int count) {
-            for (int i = 0; i < count; i++) {
-                // Random position within world radius
-                // Get player instance and check if exists
-                const auto player = game_objects::Player::GetInstance();
-                Vector2 pos;
-                float size;
-                bool validPosition = false;
-
-                // Keep generating positions until we find one that's far enough from player
-                while (!validPosition) {
-                    const float spawnAngle = GetRandomValue(0, 360) * DEG2RAD;
-                    const float distance = GetRandomValue(0, WORLD_RADIUS * 0.9f);
-                    pos = {
-                    WORLD_CENTER.x + cosf(spawnAngle) * distance,
-                    WORLD_CENTER.y + sinf(spawnAngle) * distance
-                };
-
-                // Random size (adjust min/max as needed)
-                    size = GetRandomValue(30, 70);
-
-                    // If no player or far enough from player, position is valid
-                    if (constexpr float minDistanceFromPlayer = 150.f;
-                        !player || Vector2Distance(
-                            pos, player->getTransform().center) >
-                        minDistanceFromPlayer + size) {
-                        validPosition = true;
-                    }
-                }
-
-                // Random speed (0.5 to maxSpeed)
-                float speed = GetRandomValue(50, 100); // Adjust range as needed
-
-                const auto newAst = manager.createObject<game_objects::Asteroid>(
-                    components::Transform2D(pos.x, pos.y, size, size),
-                    10,  // HP
-                    1000, // maxSpeed (adjust as needed)
-                    speed // currentSpeed (randomized)
-                );
-                const float speedAngle = GetRandomValue(0, 360) * DEG2RAD;
-                newAst->setDirectionOfSpeed(Vector2Rotate(Vector2One(), speedAngle));
-                newAst->LoadTexture(textures::asteroidTexture.c_str());
-
-                asteroids.push_back(newAst);
-            }
-        }
+        if (count <= 0) return;
 
-    void LevelManager::endLevel() {
+        // Asteroids never overlap and keep clear of the player
+        core::poisson_disk::PoissonDiskSampler sampler(WORLD_CENTER, settings.worldRadius * 0.9f, MAX_ASTEROID_SIZE);
         for (const auto& asteroid : asteroids) {
-            asteroid->destroy();
+            sampler.addObstacle(asteroid->getTransform().center);
         }
-        asteroids.clear();
+        if (const auto player = game_objects::Player::GetInstance())
+            sampler.addExclusion(player->getTransform().center, SAFE_SPAWN_DISTANCE + MAX_ASTEROID_SIZE);
+
+        std::vector<Vector2> positions;
+        positions.reserve(count);
+        sampler.sample(count, positions);
+
+        const auto asteroidRegion = core::atlas::TextureAtlas::Get(assets::TextureId::ASTEROID);
+        const auto spawned = manager.createObjects<game_objects::Asteroid>(positions.size(), [&](const size_t i) {
+            const auto size = static_cast<float>(GetRandomValue(MIN_ASTEROID_SIZE, MAX_ASTEROID_SIZE));
+            const auto speed = static_cast<float>(GetRandomValue(50, 100));
+
+            auto asteroid = std::make_shared<game_objects::Asteroid>(
+                components::Transform2D(positions[i].x, positions[i].y, size, size),
+                10,  // HP
+                1000, // maxSpeed (adjust as needed)
+                speed // currentSpeed (randomized)
+            );
+            const float speedAngle = GetRandomValue(0, 360) * DEG2RAD;
+            asteroid->setDirectionOfSpeed(Vector2Rotate(Vector2One(), speedAngle));
+            asteroid->SetTexture(asteroidRegion);
+            return asteroid;
+        });
+
+        asteroids.insert(asteroids.end(), spawned.begin(), spawned.end());
+    }
+
+    void LevelManager::saveSnapshot(core::snapshot::Blob &blob) {
+        core::snapshot::SnapshotWriter writer(blob);
+        writer.write(c_snapshotMagic);
+        writer.write(c_snapshotVersion);
+        writer.write(settings.mode);
+
+        const auto seed = static_cast<unsigned int>(GetRandomValue(0, INT_MAX));
+        SetRandomSeed(seed);
+        writer.write(seed);
 
-        if (const auto player = game_objects::Player::GetInstance()) {
-            player->destroy();
+        writer.write(score);
+        writer.write(preferredAsteroidsCount);
+
+        const auto player = game_objects::Player::GetInstance();
+        writer.write(player != nullptr);
+        if (player)
+            writer.write(player->getState());
+
+        if (settings.mode == WorldMode::SECTORS) {
+            chunkedWorld.saveState(writer);
+        }
+        else {
+            // Same layout as writeArray, so restore reads all of them in one go
+            writer.write(static_cast<uint64_t>(asteroids.size()));
+            for (const auto& asteroid : asteroids)
+                writer.write(asteroid->getState());
+        }
+
+        loop::saveState(writer);
+        projectiles::ProjectileSystem::SaveState(writer);
+        core::particles::ParticleSystem::SaveState(writer);
+        core::animation::AnimationSystem::SaveState(writer);
+    }
+
+    bool LevelManager::restoreSnapshot(const core::snapshot::Blob &blob) {
+        core::snapshot::SnapshotReader reader(blob);
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        WorldMode savedMode {};
+        if (!reader.read(magic) || magic != c_snapshotMagic ||
+            !reader.read(version) || version != c_snapshotVersion ||
+            !reader.read(savedMode) || savedMode != settings.mode)
+            return false;
+
+        unsigned int seed = 0;
+        reader.read(seed);
+        reader.read(score);
+        reader.read(preferredAsteroidsCount);
+
+        bool hasPlayer = false;
+        reader.read(hasPlayer);
+        if (hasPlayer) {
+            game_objects::PlayerState playerState;
+            reader.read(playerState);
+            if (const auto player = game_objects::Player::GetInstance(); player && !reader.failed())
+                player->setState(playerState);
         }
+
+        if (settings.mode == WorldMode::SECTORS)
+            chunkedWorld.loadState(reader);
+        else
+            restoreAsteroids(reader);
+
+        loop::loadState(reader);
+        projectiles::ProjectileSystem::LoadState(reader);
+        core::particles::ParticleSystem::LoadState(reader);
+        core::animation::AnimationSystem::LoadState(reader);
+        if (reader.failed() || !reader.atEnd())
+            return false;
+
+        SetRandomSeed(seed);
+        core::button::ButtonSystem::setInvisibility(restartButton, true);
+        return true;
+    }
+
+    void LevelManager::restoreAsteroids(core::snapshot::SnapshotReader &reader) {
+        std::vector<game_objects::AsteroidState> states;
+        if (!reader.readVector(states))
+            return;
+
+        // Objects we already have take saved states, the rest are destroyed or created
+        const size_t reused = std::min(states.size(), asteroids.size());
+        for (size_t i = 0; i < reused; i++)
+            asteroids[i]->setState(states[i]);
+
+        for (size_t i = reused; i < asteroids.size(); i++)
+            asteroids[i]->destroy();
+        asteroids.resize(reused);
+
+        const auto asteroidRegion = core::atlas::TextureAtlas::Get(assets::TextureId::ASTEROID);
+        const auto created = manager.createObjects<game_objects::Asteroid>(states.size() - reused, [&](const size_t i) {
+            const auto& state = states[reused + i];
+            auto asteroid = std::make_shared<game_objects::Asteroid>(state.transform, state.unit.hp.getValue(), 1000);
+            asteroid->setState(state);
+            asteroid->SetTexture(asteroidRegion);
+            return asteroid;
+        });
+        asteroids.insert(asteroids.end(), created.begin(), created.end());
     }
 
 }
\ No newline at end of file
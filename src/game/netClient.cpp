@@ -0,0 +1,159 @@
+#include "game/netClient.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "raymath.h"
+
+namespace game::net {
+    bool Client::connect(const core::net::Address &server, const Rectangle &view) {
+        if (!socket_.open(0))
+            return false;
+        server_ = server;
+        view_ = view;
+        sendReport();
+        return true;
+    }
+
+    void Client::disconnect() {
+        PacketWriter writer;
+        writeHeader(writer, PacketType::DISCONNECT);
+        socket_.send(server_, writer.data(), writer.size());
+        socket_.close();
+    }
+
+    const Snapshot *Client::find(const uint32_t tick) const {
+        const Snapshot &snapshot = received_[tick % SNAPSHOT_HISTORY];
+        return tick != 0 && snapshot.tick == tick ? &snapshot : nullptr;
+    }
+
+    int Client::getScore() const {
+        const Snapshot *latest = find(latestTick_);
+        return latest != nullptr ? latest->score : 0;
+    }
+
+    void Client::handle(const uint8_t *data, const size_t size) {
+        stats_.packets++;
+        stats_.bytesReceived += size;
+
+        PacketReader reader(data, size);
+        PacketType type;
+        uint32_t tick, baselineTick;
+        if (!readHeader(reader, type) || type != PacketType::SNAPSHOT || !readSnapshotTicks(reader, tick, baselineTick))
+            return;
+        if (tick <= latestTick_) {
+            stats_.late++;
+            return;
+        }
+
+        // Baseline must be older and still in history, else it could share the slot decoded into
+        if (baselineTick != 0 && (baselineTick >= tick || tick - baselineTick >= SNAPSHOT_HISTORY)) {
+            stats_.undecodable++;
+            return;
+        }
+
+        const Snapshot *baseline = nullptr;
+        if (baselineTick != 0) {
+            baseline = find(baselineTick);
+            if (baseline == nullptr) {
+                stats_.undecodable++;
+                return;
+            }
+        }
+
+        // Baseline is older than anything newer than latestTick_, so this slot is never it
+        Snapshot &snapshot = received_[tick % SNAPSHOT_HISTORY];
+        snapshot.tick = 0;
+        if (!readSnapshot(reader, baseline, snapshot)) {
+            stats_.undecodable++;
+            return;
+        }
+        snapshot.tick = tick;
+        latestTick_ = tick;
+
+        stats_.snapshots++;
+        if (baseline == nullptr)
+            stats_.fullSnapshots++;
+    }
+
+    void Client::sendReport() {
+        PacketWriter writer;
+        writeHeader(writer, PacketType::CLIENT_REPORT);
+        writeReport(writer, {latestTick_, view_});
+        socket_.send(server_, writer.data(), writer.size());
+    }
+
+    void Client::update(const float deltaTime) {
+        std::array<uint8_t, MAX_PACKET_SIZE> buffer;
+        core::net::Address from;
+        int size;
+        while ((size = socket_.receive(buffer.data(), buffer.size(), from)) >= 0) {
+            if (from == server_)
+                handle(buffer.data(), static_cast<size_t>(size));
+        }
+        // Also keeps connection alive before the first snapshot and after losses
+        sendReport();
+
+        if (latestTick_ == 0)
+            return;
+
+        // Clock runs at tick rate and is pulled toward target, so jitter does not show as stutter
+        const double target = latestTick_ - INTERPOLATION_DELAY;
+        renderTick_ += deltaTime * TICK_RATE;
+        if (std::abs(renderTick_ - target) > MAX_CLOCK_DRIFT)
+            renderTick_ = target;
+        else
+            renderTick_ += (target - renderTick_) * 0.05;
+        renderTick_ = std::min(renderTick_, static_cast<double>(latestTick_));
+    }
+
+    void Client::interpolate(std::vector<InterpolatedEntity> &out) const {
+        out.clear();
+        if (latestTick_ == 0)
+            return;
+
+        // Newest snapshot at or before render time and the oldest after it
+        const auto renderTick = static_cast<uint32_t>(std::max(renderTick_, 1.0));
+        const Snapshot *from = nullptr;
+        for (uint32_t tick = renderTick; tick > 0 && renderTick - tick < SNAPSHOT_HISTORY && !from; tick--)
+            from = find(tick);
+        const Snapshot *to = nullptr;
+        for (uint32_t tick = renderTick + 1; tick <= latestTick_ && !to; tick++)
+            to = find(tick);
+
+        if (from == nullptr)
+            from = to != nullptr ? to : find(latestTick_);
+        if (from == nullptr)
+            return;
+        if (to == nullptr)
+            to = from;
+
+        const float alpha = to->tick == from->tick
+                                ? 1.f
+                                : static_cast<float>((renderTick_ - from->tick) / (to->tick - from->tick));
+
+        // Entities come and go with the newer snapshot; both are sorted by id
+        size_t cursor = 0;
+        for (const EntityState &entity : to->entities) {
+            while (cursor < from->entities.size() && from->entities[cursor].id < entity.id)
+                cursor++;
+
+            InterpolatedEntity result {
+                entity.id, entity.kind,
+                {dequantizePosition(entity.x), dequantizePosition(entity.y)},
+                static_cast<float>(entity.size), dequantizeAngle(entity.angle)
+            };
+            if (cursor < from->entities.size() && from->entities[cursor].id == entity.id) {
+                const EntityState &previous = from->entities[cursor];
+                const Vector2 start = {dequantizePosition(previous.x), dequantizePosition(previous.y)};
+                if (Vector2Distance(start, result.center) < TELEPORT_DISTANCE) {
+                    result.center = Vector2Lerp(start, result.center, alpha);
+                    // Shortest way round
+                    const float turn = static_cast<float>(static_cast<int16_t>(entity.angle - previous.angle)) * 360.f / 65536.f;
+                    result.angle = dequantizeAngle(previous.angle) + turn * alpha;
+                }
+            }
+            out.push_back(result);
+        }
+    }
+}
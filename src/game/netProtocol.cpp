@@ -0,0 +1,192 @@
+#include "game/netProtocol.h"
+
+namespace game::net {
+    namespace {
+        enum FieldBits : uint8_t {
+            KIND = 1 << 0,
+            SIZE = 1 << 1,
+            X = 1 << 2,
+            Y = 1 << 3,
+            ANGLE = 1 << 4
+        };
+
+        /// Worst case of one entity: id gap, field mask, kind, size, x, y, angle
+        constexpr size_t MAX_ENTITY_BYTES = 3 + 1 + 1 + 1 + 5 + 5 + 3;
+        /// Type, protocol, tick, baseline tick, score, entity count
+        constexpr size_t MAX_SNAPSHOT_HEADER_BYTES = 1 + 4 + 4 + 4 + 5 + 2;
+        static_assert(MAX_SNAPSHOT_HEADER_BYTES + MAX_SNAPSHOT_ENTITIES * MAX_ENTITY_BYTES <= MAX_PACKET_SIZE,
+                      "Snapshot may not fit a packet");
+
+        const EntityState c_zeroEntity {};
+
+        /// Difference that wraps instead of overflowing; applyDelta undoes it
+        int32_t delta(const int32_t value, const int32_t base) {
+            return static_cast<int32_t>(static_cast<uint32_t>(value) - static_cast<uint32_t>(base));
+        }
+
+        int32_t applyDelta(const int32_t base, const int32_t difference) {
+            return static_cast<int32_t>(static_cast<uint32_t>(base) + static_cast<uint32_t>(difference));
+        }
+
+        /// Baseline entity with given id, walking a cursor over ids sorted the same way
+        const EntityState &findBase(const Snapshot *baseline, size_t &cursor, const uint16_t id) {
+            if (baseline == nullptr)
+                return c_zeroEntity;
+            const auto &entities = baseline->entities;
+            while (cursor < entities.size() && entities[cursor].id < id)
+                cursor++;
+            return cursor < entities.size() && entities[cursor].id == id ? entities[cursor] : c_zeroEntity;
+        }
+    }
+
+    void PacketWriter::writeU8(const uint8_t value) {
+        if (size_ >= data_.size()) {
+            failed_ = true;
+            return;
+        }
+        data_[size_++] = value;
+    }
+
+    void PacketWriter::writeU32(const uint32_t value) {
+        for (int shift = 0; shift < 32; shift += 8)
+            writeU8(static_cast<uint8_t>(value >> shift));
+    }
+
+    void PacketWriter::writeVarint(uint32_t value) {
+        while (value >= 0x80) {
+            writeU8(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        writeU8(static_cast<uint8_t>(value));
+    }
+
+    void PacketWriter::writeSigned(const int32_t value) {
+        const auto bits = static_cast<uint32_t>(value);
+        writeVarint(bits << 1 ^ (value < 0 ? 0xFFFFFFFFu : 0u));
+    }
+
+    uint8_t PacketReader::readU8() {
+        if (offset_ >= size_) {
+            failed_ = true;
+            return 0;
+        }
+        return data_[offset_++];
+    }
+
+    uint32_t PacketReader::readU32() {
+        uint32_t value = 0;
+        for (int shift = 0; shift < 32; shift += 8)
+            value |= static_cast<uint32_t>(readU8()) << shift;
+        return value;
+    }
+
+    uint32_t PacketReader::readVarint() {
+        uint32_t value = 0;
+        for (int shift = 0; shift < 35; shift += 7) {
+            const uint8_t byte = readU8();
+            value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80))
+                return value;
+        }
+        failed_ = true;
+        return 0;
+    }
+
+    int32_t PacketReader::readSigned() {
+        const uint32_t bits = readVarint();
+        return static_cast<int32_t>(bits >> 1 ^ (0u - (bits & 1)));
+    }
+
+    void writeHeader(PacketWriter &writer, const PacketType type) {
+        writer.writeU32(PROTOCOL_ID);
+        writer.writeU8(static_cast<uint8_t>(type));
+    }
+
+    bool readHeader(PacketReader &reader, PacketType &type) {
+        if (reader.readU32() != PROTOCOL_ID)
+            return false;
+        const uint8_t value = reader.readU8();
+        type = static_cast<PacketType>(value);
+        return !reader.failed() && value <= static_cast<uint8_t>(PacketType::SNAPSHOT);
+    }
+
+    void writeReport(PacketWriter &writer, const ClientReport &report) {
+        writer.writeU32(report.ackTick);
+        writer.writeSigned(quantizePosition(report.view.x));
+        writer.writeSigned(quantizePosition(report.view.y));
+        writer.writeSigned(quantizePosition(report.view.width));
+        writer.writeSigned(quantizePosition(report.view.height));
+    }
+
+    bool readReport(PacketReader &reader, ClientReport &report) {
+        report.ackTick = reader.readU32();
+        report.view.x = dequantizePosition(reader.readSigned());
+        report.view.y = dequantizePosition(reader.readSigned());
+        report.view.width = dequantizePosition(reader.readSigned());
+        report.view.height = dequantizePosition(reader.readSigned());
+        return !reader.failed() && reader.atEnd();
+    }
+
+    void writeSnapshot(PacketWriter &writer, const Snapshot &snapshot, const Snapshot *baseline) {
+        writer.writeU32(snapshot.tick);
+        writer.writeU32(baseline != nullptr ? baseline->tick : 0);
+        writer.writeSigned(snapshot.score);
+        writer.writeVarint(static_cast<uint32_t>(snapshot.entities.size()));
+
+        size_t cursor = 0;
+        uint16_t previousId = 0;
+        for (const EntityState &entity : snapshot.entities) {
+            const EntityState &base = findBase(baseline, cursor, entity.id);
+            uint8_t fields = 0;
+            if (entity.kind != base.kind) fields |= KIND;
+            if (entity.size != base.size) fields |= SIZE;
+            if (entity.x != base.x) fields |= X;
+            if (entity.y != base.y) fields |= Y;
+            if (entity.angle != base.angle) fields |= ANGLE;
+
+            // An entity that did not change costs its id gap and an empty mask
+            writer.writeVarint(entity.id - previousId);
+            writer.writeU8(fields);
+            if (fields & KIND) writer.writeU8(static_cast<uint8_t>(entity.kind));
+            if (fields & SIZE) writer.writeU8(entity.size);
+            if (fields & X) writer.writeSigned(delta(entity.x, base.x));
+            if (fields & Y) writer.writeSigned(delta(entity.y, base.y));
+            if (fields & ANGLE) writer.writeSigned(static_cast<int16_t>(entity.angle - base.angle));
+            previousId = entity.id;
+        }
+    }
+
+    bool readSnapshotTicks(PacketReader &reader, uint32_t &tick, uint32_t &baselineTick) {
+        tick = reader.readU32();
+        baselineTick = reader.readU32();
+        return !reader.failed() && tick != 0;
+    }
+
+    bool readSnapshot(PacketReader &reader, const Snapshot *baseline, Snapshot &out) {
+        out.score = reader.readSigned();
+        const uint32_t count = reader.readVarint();
+        if (reader.failed() || count > MAX_SNAPSHOT_ENTITIES)
+            return false;
+
+        out.entities.resize(count);
+        size_t cursor = 0;
+        uint32_t id = 0;
+        for (EntityState &entity : out.entities) {
+            // Ids are sorted and unique, so every gap is positive
+            const uint32_t gap = reader.readVarint();
+            if (gap == 0 || gap > UINT16_MAX - id)
+                return false;
+            id += gap;
+
+            const EntityState &base = findBase(baseline, cursor, static_cast<uint16_t>(id));
+            const uint8_t fields = reader.readU8();
+            entity.id = static_cast<uint16_t>(id);
+            entity.kind = fields & KIND ? static_cast<EntityKind>(reader.readU8()) : base.kind;
+            entity.size = fields & SIZE ? reader.readU8() : base.size;
+            entity.x = fields & X ? applyDelta(base.x, reader.readSigned()) : base.x;
+            entity.y = fields & Y ? applyDelta(base.y, reader.readSigned()) : base.y;
+            entity.angle = fields & ANGLE ? static_cast<uint16_t>(base.angle + reader.readSigned()) : base.angle;
+        }
+        return !reader.failed() && reader.atEnd();
+    }
+}
@@ -0,0 +1,209 @@
+#include "game/netServer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <typeinfo>
+
+#include "raymath.h"
+#include "game/physicsWorld.h"
+#include "game/entities/player.h"
+#include "game/entities/units.h"
+
+namespace game::net {
+    ServerStats &ServerStats::operator+=(const ServerStats &other) {
+        snapshots += other.snapshots;
+        fullSnapshots += other.fullSnapshots;
+        bytesSent += other.bytesSent;
+        cpuSeconds += other.cpuSeconds;
+        sendSeconds += other.sendSeconds;
+        return *this;
+    }
+
+    ServerStats ServerStats::operator-(const ServerStats &other) const {
+        return {snapshots - other.snapshots, fullSnapshots - other.fullSnapshots,
+                bytesSent - other.bytesSent, cpuSeconds - other.cpuSeconds, sendSeconds - other.sendSeconds};
+    }
+
+    bool Server::open(const uint16_t port) {
+        return socket_.open(port);
+    }
+
+    Server::Client *Server::findClient(const core::net::Address &address) {
+        const auto it = std::ranges::find_if(clients_, [&](const auto &client) { return client->address == address; });
+        return it != clients_.end() ? it->get() : nullptr;
+    }
+
+    void Server::receive(const double now) {
+        std::array<uint8_t, MAX_PACKET_SIZE> buffer;
+        core::net::Address from;
+        int size;
+        while ((size = socket_.receive(buffer.data(), buffer.size(), from)) >= 0)
+            handle(buffer.data(), static_cast<size_t>(size), from, now);
+
+        for (size_t i = clients_.size(); i-- > 0;) {
+            if (now - clients_[i]->lastHeard > CLIENT_TIMEOUT)
+                disconnect(i, "timed out");
+        }
+    }
+
+    void Server::handle(const uint8_t *data, const size_t size, const core::net::Address &from, const double now) {
+        PacketReader reader(data, size);
+        PacketType type;
+        if (!readHeader(reader, type))
+            return;
+
+        if (type == PacketType::DISCONNECT) {
+            const auto it = std::ranges::find_if(clients_, [&](const auto &client) { return client->address == from; });
+            if (it != clients_.end())
+                disconnect(it - clients_.begin(), "disconnected");
+            return;
+        }
+
+        ClientReport report;
+        if (type != PacketType::CLIENT_REPORT || !readReport(reader, report))
+            return;
+
+        Client *client = findClient(from);
+        if (client == nullptr) {
+            if (clients_.size() >= MAX_CLIENTS)
+                return;
+            clients_.push_back(std::make_unique<Client>());
+            client = clients_.back().get();
+            client->address = from;
+            TraceLog(LOG_INFO, "NET: Client %u.%u.%u.%u:%u connected", from.host >> 24, from.host >> 16 & 0xFF,
+                     from.host >> 8 & 0xFF, from.host & 0xFF, from.port);
+        }
+
+        client->lastHeard = now;
+        client->view = {report.view.x, report.view.y,
+                        std::clamp(report.view.width, 0.f, MAX_VIEW_SIZE),
+                        std::clamp(report.view.height, 0.f, MAX_VIEW_SIZE)};
+        // Reports may come out of order; an older ack is still valid but a worse baseline.
+        // One from the future would pin the client to full snapshots, so it is dropped
+        if (report.ackTick <= lastTick_)
+            client->ackTick = std::max(client->ackTick, report.ackTick);
+    }
+
+    void Server::disconnect(const size_t index, const char *reason) {
+        const Client &client = *clients_[index];
+        const ServerStats &stats = client.stats;
+        TraceLog(LOG_INFO, "NET: Client %u.%u.%u.%u:%u %s: %llu snapshots (%llu full), %.1f KB, %.1f us per snapshot "
+                 "+ %.1f us sending",
+                 client.address.host >> 24, client.address.host >> 16 & 0xFF, client.address.host >> 8 & 0xFF,
+                 client.address.host & 0xFF, client.address.port, reason,
+                 static_cast<unsigned long long>(stats.snapshots), static_cast<unsigned long long>(stats.fullSnapshots),
+                 static_cast<double>(stats.bytesSent) / 1024,
+                 stats.snapshots > 0 ? stats.cpuSeconds * 1e6 / static_cast<double>(stats.snapshots) : 0.0,
+                 stats.snapshots > 0 ? stats.sendSeconds * 1e6 / static_cast<double>(stats.snapshots) : 0.0);
+        clients_.erase(clients_.begin() + static_cast<ptrdiff_t>(index));
+    }
+
+    uint16_t Server::netIdOf(const game_objects::GameObject &object, const uint32_t tick) {
+        if (const auto it = netIds_.find(object.getId()); it != netIds_.end()) {
+            it->second.lastSent = tick;
+            return it->second.id;
+        }
+
+        uint16_t id;
+        if (!freeIds_.empty()) {
+            id = freeIds_.back();
+            freeIds_.pop_back();
+        }
+        else if (nextId_ != 0) {
+            id = nextId_++;  // Wraps to zero after the last one, which marks exhaustion
+        }
+        else {
+            return 0;
+        }
+        netIds_.emplace(object.getId(), NetId {id, tick});
+        return id;
+    }
+
+    void Server::releaseStaleIds(const uint32_t tick) {
+        std::erase_if(netIds_, [&](const auto &entry) {
+            if (tick - entry.second.lastSent < SNAPSHOT_HISTORY)
+                return false;
+            freeIds_.push_back(entry.second.id);
+            return true;
+        });
+    }
+
+    void Server::collect(const Client &client, Snapshot &snapshot, const uint32_t tick) {
+        const size_t found = physics::PhysicsWorld::QueryBounds(client.view, visible_);
+        const auto visible = std::span(visible_).first(found);
+
+        // Crowded view: nearest to its center go, rest wait until they are closer
+        if (visible.size() > MAX_SNAPSHOT_ENTITIES) {
+            const Vector2 center = {client.view.x + client.view.width / 2, client.view.y + client.view.height / 2};
+            std::ranges::nth_element(visible, visible.begin() + MAX_SNAPSHOT_ENTITIES, {},
+                                     [&](game_objects::CollidingObject *body) {
+                                         return Vector2DistanceSqr(body->getTransform().center, center);
+                                     });
+        }
+
+        snapshot.entities.clear();
+        for (game_objects::CollidingObject *body : visible.first(std::min(visible.size(), MAX_SNAPSHOT_ENTITIES))) {
+            EntityState entity;
+            const components::Transform2D &transform = body->getTransform();
+            // Both classes are final: exact type check, no walk through the virtual bases per body
+            const std::type_info &type = typeid(*body);
+            if (type == typeid(game_objects::Player)) {
+                entity.kind = EntityKind::PLAYER;
+                entity.angle = quantizeAngle(static_cast<game_objects::Player*>(body)->getAngle() * RAD2DEG);
+            }
+            else if (type == typeid(game_objects::Asteroid)) {
+                entity.kind = EntityKind::ASTEROID;
+                entity.angle = quantizeAngle(transform.angle);
+            }
+            else {
+                continue;
+            }
+
+            entity.id = netIdOf(*body, tick);
+            if (entity.id == 0)
+                continue;
+            entity.size = static_cast<uint8_t>(std::clamp(transform.scaledSize().x, 0.f, 255.f));
+            entity.x = quantizePosition(transform.center.x);
+            entity.y = quantizePosition(transform.center.y);
+            snapshot.entities.push_back(entity);
+        }
+        std::ranges::sort(snapshot.entities, {}, &EntityState::id);
+    }
+
+    void Server::sendSnapshot(Client &client, const uint32_t tick, const int score) {
+        const auto start = std::chrono::steady_clock::now();
+
+        Snapshot &snapshot = client.history[tick % SNAPSHOT_HISTORY];
+        snapshot.tick = tick;
+        snapshot.score = score;
+        collect(client, snapshot, tick);
+
+        const Snapshot &acked = client.history[client.ackTick % SNAPSHOT_HISTORY];
+        const bool hasBaseline = client.ackTick != 0 && acked.tick == client.ackTick &&
+                                 tick - client.ackTick < SNAPSHOT_HISTORY;
+
+        PacketWriter writer;
+        writeHeader(writer, PacketType::SNAPSHOT);
+        writeSnapshot(writer, snapshot, hasBaseline ? &acked : nullptr);
+
+        const auto encoded = std::chrono::steady_clock::now();
+        if (!writer.failed())
+            socket_.send(client.address, writer.data(), writer.size());
+
+        ServerStats sent;
+        sent.snapshots = 1;
+        sent.fullSnapshots = hasBaseline ? 0 : 1;
+        sent.bytesSent = writer.size();
+        sent.cpuSeconds = std::chrono::duration<double>(encoded - start).count();
+        sent.sendSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - encoded).count();
+        client.stats += sent;
+        stats_ += sent;
+    }
+
+    void Server::broadcast(const uint32_t tick, const int score) {
+        lastTick_ = tick;
+        for (const auto &client : clients_)
+            sendSnapshot(*client, tick, score);
+        releaseStaleIds(tick);
+    }
+}
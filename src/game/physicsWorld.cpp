@@ -0,0 +1,126 @@
+#include "game/physicsWorld.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "core/physicsStats.h"
+#include "core/profiler.h"
+#include "game/gameObjectManager.h"
+
+namespace game::physics {
+    core::spatial::SpatialGrid PhysicsWorld::s_grid(CELL_SIZE);
+    std::vector<game_objects::CollidingObject*> PhysicsWorld::s_bodies;
+    Rectangle PhysicsWorld::s_extent = {0, 0, 0, 0};
+
+    void PhysicsWorld::rebuild() {
+        PROFILE_ZONE("Broad-phase");
+        s_grid.clear();
+        s_bodies.clear();
+
+        float left = INFINITY, top = INFINITY, right = -INFINITY, bottom = -INFINITY;
+        for (auto *body : management::GameObjectManager::getInstance().getCollidingObjects()) {
+            if (!body->isActive()) continue;
+
+            const Rectangle bounds = body->collider->getBounds();
+            s_grid.insert(bounds);
+            s_bodies.push_back(body);
+
+            left = std::min(left, bounds.x);
+            top = std::min(top, bounds.y);
+            right = std::max(right, bounds.x + bounds.width);
+            bottom = std::max(bottom, bounds.y + bounds.height);
+        }
+        s_grid.build();
+        s_extent = s_bodies.empty() ? Rectangle{0, 0, 0, 0} : Rectangle{left, top, right - left, bottom - top};
+    }
+
+    void PhysicsWorld::resolvePairs() {
+        PROFILE_ZONE("Narrow-phase");
+        for (uint32_t i = 0; i < s_bodies.size(); i++) {
+            game_objects::CollidingObject *first = s_bodies[i];
+            if (!first->isActive()) continue;
+
+            s_grid.query(s_grid.getBounds(i), [&](const uint32_t j) {
+                // Every pair is seen from both sides; handle it from the lower index only
+                if (j <= i) return;
+
+                game_objects::CollidingObject *second = s_bodies[j];
+                if (!first->isActive() || !second->isActive()) return;
+                PHYSICS_COUNT(stats.broadPhasePairs++);
+
+                if (!first->collider->checkCollision(*second->collider) or
+                    !second->collider->checkCollision(*first->collider)) return;
+
+                PHYSICS_COUNT(stats.contacts++);
+                first->onCollided(second);
+                second->onCollided(first);
+            });
+        }
+    }
+
+    bool PhysicsWorld::overlaps(components::Collider &shape, game_objects::CollidingObject *body) {
+        return shape.checkCollision(*body->collider) and body->collider->checkCollision(shape);
+    }
+
+    bool PhysicsWorld::sweep(components::Collider &shape, const Vector2 from, const Vector2 to,
+                             components::Collider &target, float &fraction) {
+        const auto overlapsAt = [&](const float t) {
+            shape.setCenter(Vector2Lerp(from, to, t));
+            return shape.checkCollision(target) and target.checkCollision(shape);
+        };
+
+        // Steps of half the smaller shape can't jump over a contact
+        shape.setCenter(from);
+        const Rectangle shapeBounds = shape.getBounds();
+        const Rectangle targetBounds = target.getBounds();
+        const float step = std::max(1.f, 0.5f * std::min({shapeBounds.width, shapeBounds.height,
+                                                          targetBounds.width, targetBounds.height}));
+        const int steps = std::clamp(static_cast<int>(std::ceil(Vector2Distance(from, to) / step)),
+                                     1, MAX_SHAPECAST_STEPS);
+
+        bool hit = false;
+        if (overlapsAt(0)) {
+            fraction = 0;
+            hit = true;
+        }
+        for (int i = 1; i <= steps && !hit; i++) {
+            const float outside = static_cast<float>(i - 1) / static_cast<float>(steps);
+            const float t = static_cast<float>(i) / static_cast<float>(steps);
+            if (!overlapsAt(t)) continue;
+
+            // Bisect between last free point and first touching one
+            float low = outside, high = t;
+            for (int j = 0; j < SHAPECAST_REFINE_STEPS; j++) {
+                const float middle = (low + high) / 2;
+                (overlapsAt(middle) ? high : low) = middle;
+            }
+            fraction = high;
+            hit = true;
+        }
+
+        shape.setCenter(from);
+        return hit;
+    }
+
+    void PhysicsWorld::Step(const float deltaTime) {
+        core::physics_stats::PhysicsStats::BeginStep();
+        for (const auto& gameObject : game_objects::GameObject::s_allObjects) {
+            if (!gameObject->isActive()) continue;
+            gameObject->physUpdate(deltaTime);
+        }
+
+        rebuild();
+        resolvePairs();
+        core::physics_stats::PhysicsStats::EndStep();
+    }
+
+    void PhysicsWorld::Sync() {
+        rebuild();
+    }
+
+    void PhysicsWorld::Clear() {
+        s_grid.clear();
+        s_bodies.clear();
+        s_extent = {0, 0, 0, 0};
+    }
+}
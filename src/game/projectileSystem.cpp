@@ -0,0 +1,160 @@
+#include "game/projectileSystem.h"
+
+#include <limits>
+
+#include "raymath.h"
+#include "core/renderCulling.h"
+#include "core/renderQueue.h"
+#include "game/physicsWorld.h"
+#include "game/entities/units.h"
+
+namespace game::projectiles {
+    std::vector<float> ProjectileSystem::s_posX;
+    std::vector<float> ProjectileSystem::s_posY;
+    std::vector<float> ProjectileSystem::s_velX;
+    std::vector<float> ProjectileSystem::s_velY;
+    std::vector<float> ProjectileSystem::s_life;
+    std::vector<float> ProjectileSystem::s_radius;
+    std::vector<int> ProjectileSystem::s_damage;
+    size_t ProjectileSystem::s_count = 0;
+
+    Vector2 ProjectileSystem::s_boundsCenter = {0, 0};
+    float ProjectileSystem::s_boundsRadiusSqr = std::numeric_limits<float>::infinity();
+
+    Texture2D ProjectileSystem::s_texture = {};
+
+    void ProjectileSystem::Init(const size_t capacity) {
+        for (auto *array : {&s_posX, &s_posY, &s_velX, &s_velY, &s_life, &s_radius})
+            array->assign(capacity, 0.f);
+        s_damage.assign(capacity, 0);
+        s_count = 0;
+
+        // Same look bullets had when drawn with two DrawCircle calls, but batchable
+        std::vector<Color> pixels(TEXTURE_SIZE * TEXTURE_SIZE, BLANK);
+        constexpr float center = (TEXTURE_SIZE - 1) / 2.f;
+        constexpr float outer = TEXTURE_SIZE / 2.f;
+        for (int y = 0; y < TEXTURE_SIZE; y++) {
+            for (int x = 0; x < TEXTURE_SIZE; x++) {
+                const float distance = Vector2Length({x - center, y - center});
+                if (distance <= outer - 1.5f)
+                    pixels[y * TEXTURE_SIZE + x] = RED;
+                else if (distance <= outer)
+                    pixels[y * TEXTURE_SIZE + x] = YELLOW;
+            }
+        }
+        const Image image = {pixels.data(), TEXTURE_SIZE, TEXTURE_SIZE, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+        s_texture = LoadTextureFromImage(image);
+    }
+
+    void ProjectileSystem::Shutdown() {
+        for (auto *array : {&s_posX, &s_posY, &s_velX, &s_velY, &s_life, &s_radius}) {
+            array->clear();
+            array->shrink_to_fit();
+        }
+        s_damage.clear();
+        s_damage.shrink_to_fit();
+        s_count = 0;
+
+        UnloadTexture(s_texture);
+        s_texture = {};
+    }
+
+    void ProjectileSystem::SetBounds(const Vector2 center, const float radius) {
+        s_boundsCenter = center;
+        s_boundsRadiusSqr = radius * radius;
+    }
+
+    void ProjectileSystem::Spawn(const Vector2 position, const Vector2 velocity, const float radius,
+                                 const int damage, const float lifetime) {
+        if (s_count >= s_posX.size()) return;
+
+        const size_t i = s_count++;
+        s_posX[i] = position.x;
+        s_posY[i] = position.y;
+        s_velX[i] = velocity.x;
+        s_velY[i] = velocity.y;
+        s_life[i] = lifetime;
+        s_radius[i] = radius;
+        s_damage[i] = damage;
+    }
+
+    void ProjectileSystem::remove(const size_t i) {
+        // Swap-remove: last projectile takes the removed one's slot
+        const size_t last = --s_count;
+        s_posX[i] = s_posX[last];
+        s_posY[i] = s_posY[last];
+        s_velX[i] = s_velX[last];
+        s_velY[i] = s_velY[last];
+        s_life[i] = s_life[last];
+        s_radius[i] = s_radius[last];
+        s_damage[i] = s_damage[last];
+    }
+
+    void ProjectileSystem::Update(const float deltaTime) {
+        const auto isTarget = [](game_objects::CollidingObject *body) {
+            return dynamic_cast<game_objects::Asteroid*>(body) != nullptr;
+        };
+
+        for (size_t i = 0; i < s_count;) {
+            const Vector2 from = {s_posX[i], s_posY[i]};
+            const Vector2 to = {from.x + s_velX[i] * deltaTime, from.y + s_velY[i] * deltaTime};
+
+            // Swept test, so fast projectiles can't skip over thin targets between steps
+            if (physics::SegmentHit hit; physics::PhysicsWorld::SegmentCast(from, to, s_radius[i], hit, isTarget)) {
+                static_cast<game_objects::Asteroid*>(hit.object)->takeDamage(s_damage[i]);
+                remove(i);
+                continue;
+            }
+
+            s_life[i] -= deltaTime;
+            if (s_life[i] <= 0 || Vector2DistanceSqr(to, s_boundsCenter) > s_boundsRadiusSqr) {
+                remove(i);
+                continue;
+            }
+
+            s_posX[i] = to.x;
+            s_posY[i] = to.y;
+            i++;
+        }
+    }
+
+    void ProjectileSystem::Draw() {
+        const Rectangle &view = core::render::RenderCulling::GetView();
+        const float right = view.x + view.width;
+        const float bottom = view.y + view.height;
+        constexpr Rectangle source = {0, 0, TEXTURE_SIZE, TEXTURE_SIZE};
+
+        for (size_t i = 0; i < s_count; i++) {
+            const float x = s_posX[i];
+            const float y = s_posY[i];
+            const float radius = s_radius[i];
+            if (x + radius < view.x || x - radius > right || y + radius < view.y || y - radius > bottom) continue;
+
+            core::render::RenderQueue::Submit(s_texture, source, {x, y, 2 * radius, 2 * radius},
+                                              {radius, radius}, 0, WHITE, core::render::EFFECTS);
+        }
+    }
+
+    void ProjectileSystem::SaveState(core::snapshot::SnapshotWriter &writer) {
+        for (const auto *array : {&s_posX, &s_posY, &s_velX, &s_velY, &s_life, &s_radius})
+            writer.writeArray(array->data(), s_count);
+        writer.writeArray(s_damage.data(), s_count);
+    }
+
+    bool ProjectileSystem::LoadState(core::snapshot::SnapshotReader &reader) {
+        const size_t count = reader.readArray(s_posX.data(), s_posX.size());
+        for (auto *array : {&s_posY, &s_velX, &s_velY, &s_life, &s_radius}) {
+            if (reader.readArray(array->data(), array->size()) != count)
+                return false;
+        }
+        if (reader.readArray(s_damage.data(), s_damage.size()) != count)
+            return false;
+
+        s_count = reader.failed() ? 0 : count;
+        return !reader.failed();
+    }
+
+    void ProjectileSystem::Clear() {
+        s_count = 0;
+    }
+}
@@ -0,0 +1,118 @@
+#include "game/simulationThread.h"
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+#include "UI/buttonSystem.h"
+#include "core/allocationTracker.h"
+#include "core/animation.h"
+#include "core/cameraSystem.h"
+#include "core/input.h"
+#include "core/particleSystem.h"
+#include "core/profiler.h"
+#include "game/entities/player.h"
+#include "game/gameLoop.h"
+#include "game/gameObjectManager.h"
+#include "game/projectileSystem.h"
+
+namespace game::simulation {
+    SimulationThread::SimulationThread(const components::GameCamera &camera,
+                                       std::shared_ptr<management::LevelManager> levelManager):
+        camera_(camera), levelManager_(std::move(levelManager)) {}
+
+    SimulationThread::~SimulationThread() {
+        stop();
+    }
+
+    void SimulationThread::start() {
+        if (thread_.joinable())
+            return;
+        stopping_.store(false, std::memory_order_relaxed);
+        thread_ = std::thread(&SimulationThread::run, this);
+    }
+
+    void SimulationThread::stop() {
+        if (!thread_.joinable())
+            return;
+        stopping_.store(true, std::memory_order_release);
+        thread_.join();
+    }
+
+    void SimulationThread::run() {
+        core::profiling::Profiler::SetThreadName("Simulation");
+
+        using Clock = std::chrono::steady_clock;
+        const auto period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1 / TICK_RATE));
+        auto last = Clock::now();
+        auto next = last;
+        while (!stopping_.load(std::memory_order_acquire)) {
+            const auto now = Clock::now();
+            tick(std::min(std::chrono::duration<float>(now - last).count(), MAX_FRAME_TIME));
+            last = now;
+
+            // Behind schedule: carry on from now rather than running ticks back to back to catch up
+            next = std::max(next + period, Clock::now());
+            std::this_thread::sleep_until(next);
+        }
+    }
+
+    void SimulationThread::tick(const float frameTime) {
+        // Own profiler frame per tick, shown in the overlay under this thread's name
+        core::profiling::Profiler::BeginFrame();
+        simulateTick(frameTime);
+        core::profiling::Profiler::EndFrame();
+    }
+
+    void SimulationThread::simulateTick(const float frameTime) {
+        PROFILE_ZONE("Simulation tick");
+        core::input::Input::BeginTick();
+
+        loop::updateSimulation(frameTime);
+
+        {
+            ALLOCATION_SCOPE(RENDER);
+            PROFILE_ZONE("Camera");
+            if (const auto player = game_objects::Player::GetInstance())
+                core::systems::CameraSystem::UpdateCamera(camera_, *player, frameTime);
+        }
+
+        {
+            ALLOCATION_SCOPE(UI);
+            PROFILE_ZONE("UI");
+            core::button::ButtonSystem::Update();
+        }
+
+        record(snapshots_.getWriteSlot());
+        snapshots_.publish();
+
+        // Snapshot holds copies only, so objects can go right after it is published
+        loop::cleanup();
+    }
+
+    void SimulationThread::record(RenderSnapshot &snapshot) {
+        ALLOCATION_SCOPE(RENDER);
+        PROFILE_ZONE("Record");
+
+        snapshot.tick = ++tick_;
+        snapshot.camera = camera_;
+        snapshot.view = core::systems::CameraSystem::GetVisibleRect(camera_);
+
+        core::render::RenderCulling::BeginFrame(snapshot.view);
+        const auto& objectManager = management::GameObjectManager::getInstance();
+        core::render::RenderCulling::DrawVisible(objectManager.getDrawnOnlyObjects(),
+                                                 objectManager.getDrawnObjects().size());
+        core::animation::AnimationSystem::Draw();
+        core::particles::ParticleSystem::Draw();
+        projectiles::ProjectileSystem::Draw();
+        core::render::RenderCulling::EndFrame();
+
+        if (const auto player = game_objects::Player::GetInstance())
+            core::button::ButtonSystem::Draw(player->getTransform());
+
+        core::render::RenderQueue::Take(snapshot.world);
+        snapshot.culling = core::render::RenderCulling::GetLastStats();
+        snapshot.score = levelManager_->getScore();
+        snapshot.physics = core::physics_stats::PhysicsStats::GetLastStep();
+    }
+}
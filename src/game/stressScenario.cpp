@@ -0,0 +1,262 @@
+#include "game/stressScenario.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#include "core/nullBackend.h"
+#include "core/profiler.h"
+#include "game/entities/player.h"
+#include "game/projectileSystem.h"
+
+namespace game::stress {
+    namespace {
+        /// Same shots the player fires itself
+        constexpr float SHOT_SPEED = 300;
+        constexpr float SHOT_RADIUS = 5;
+        constexpr int SHOT_DAMAGE = 10;
+
+        /// Waypoint counts as reached this close
+        constexpr float WAYPOINT_RADIUS = 80;
+        /// Heading error, radians, below which steering keys are released
+        constexpr float STEER_DEADBAND = 0.1f;
+        /// Heading error below which player thrusts towards waypoint
+        constexpr float THRUST_CONE = 0.5f;
+        /// Player's turn deceleration with keys released, radians/s^2
+        constexpr float TURN_BRAKING = 10;
+        /// Speed allowed per unit of distance to waypoint, 1/s. Slowing down near it keeps
+        /// turning circle small enough to not orbit the waypoint forever
+        constexpr float APPROACH_GAIN = 1;
+
+        std::string trim(const std::string &text) {
+            const size_t first = text.find_first_not_of(" \t\r");
+            if (first == std::string::npos) return "";
+            return text.substr(first, text.find_last_not_of(" \t\r") - first + 1);
+        }
+
+        bool parseWaypoints(const std::string &text, std::vector<Vector2> &out) {
+            std::istringstream stream(text);
+            std::string point;
+            while (stream >> point) {
+                Vector2 waypoint;
+                if (std::sscanf(point.c_str(), "%f,%f", &waypoint.x, &waypoint.y) != 2)
+                    return false;
+                out.push_back(waypoint);
+            }
+            return true;
+        }
+
+        bool applyKey(const std::string &key, const std::string &value, const std::string &directory,
+                      Scenario &scenario) {
+            if (key == "name") scenario.name = value;
+            else if (key == "frames") scenario.frames = std::strtoul(value.c_str(), nullptr, 10);
+            else if (key == "dt") scenario.deltaTime = std::strtof(value.c_str(), nullptr);
+            else if (key == "seed") scenario.seed = static_cast<unsigned int>(std::strtoul(value.c_str(), nullptr, 10));
+            else if (key == "world_radius") scenario.level.worldRadius = std::strtof(value.c_str(), nullptr);
+            else if (key == "asteroids") scenario.level.asteroidCount = std::atoi(value.c_str());
+            else if (key == "player_hp") scenario.playerHp = std::atoi(value.c_str());
+            else if (key == "fire_rate") scenario.fireRate = std::strtof(value.c_str(), nullptr);
+            else if (key == "input") scenario.inputScript = directory + value;
+            else if (key == "world") {
+                if (value == "sectors") scenario.level.mode = management::WorldMode::SECTORS;
+                else if (value == "arena") scenario.level.mode = management::WorldMode::ARENA;
+                else return false;
+            }
+            else if (key == "waypoints") {
+                scenario.waypoints.clear();
+                return parseWaypoints(value, scenario.waypoints);
+            }
+            else
+                return false;
+            return true;
+        }
+    }
+
+    bool LoadScenario(const std::string &path, Scenario &scenario) {
+        std::ifstream file(path);
+        if (!file) {
+            TraceLog(LOG_WARNING, "SCENARIO: Failed to open %s", path.c_str());
+            return false;
+        }
+
+        const size_t slash = path.find_last_of("/\\");
+        const std::string directory = slash == std::string::npos ? "" : path.substr(0, slash + 1);
+
+        std::string line;
+        for (int number = 1; std::getline(file, line); number++) {
+            line = trim(line.substr(0, line.find('#')));
+            if (line.empty()) continue;
+
+            const size_t equals = line.find('=');
+            if (equals == std::string::npos ||
+                !applyKey(trim(line.substr(0, equals)), trim(line.substr(equals + 1)), directory, scenario)) {
+                TraceLog(LOG_WARNING, "SCENARIO: %s:%d: can't parse \"%s\"", path.c_str(), number, line.c_str());
+                return false;
+            }
+        }
+        return scenario.deltaTime > 0;
+    }
+
+    void ScenarioDriver::steer(const float deltaTime) {
+        const auto player = game_objects::Player::GetInstance();
+        if (scenario_.waypoints.empty() || player == nullptr || player->isDead())
+            return;
+
+        const Vector2 center = player->getTransform().center;
+        Vector2 target = scenario_.waypoints[waypoint_];
+        if (Vector2Distance(center, target) < WAYPOINT_RADIUS) {
+            waypoint_ = (waypoint_ + 1) % scenario_.waypoints.size();
+            target = scenario_.waypoints[waypoint_];
+        }
+
+        const Vector2 nose = Vector2Subtract(player->getVertices()[2], center);
+        const float angle = std::atan2(nose.y, nose.x);
+        float turnRate = 0;
+        if (hasLastAngle_)
+            turnRate = std::remainder(angle - lastAngle_, 2 * PI) / deltaTime;
+        lastAngle_ = angle;
+        hasLastAngle_ = true;
+
+        // Turning keeps going after keys are released, so aim where it would stop
+        const Vector2 toTarget = Vector2Subtract(target, center);
+        const float error = std::remainder(std::atan2(toTarget.y, toTarget.x) - angle, 2 * PI);
+        const float drift = turnRate * std::abs(turnRate) / (2 * TURN_BRAKING);
+        const float correction = error - drift;
+
+        const bool braking = player->getSpeedModule() > Vector2Length(toTarget) * APPROACH_GAIN;
+
+        core::headless::SetKeyDown(KEY_D, correction > STEER_DEADBAND);
+        core::headless::SetKeyDown(KEY_A, correction < -STEER_DEADBAND);
+        core::headless::SetKeyDown(KEY_W, !braking && std::abs(error) < THRUST_CONE);
+        core::headless::SetKeyDown(KEY_LEFT_CONTROL, braking);
+    }
+
+    void ScenarioDriver::fire(const float deltaTime) {
+        const auto player = game_objects::Player::GetInstance();
+        if (scenario_.fireRate <= 0 || player == nullptr || player->isDead())
+            return;
+
+        shotsDue_ += scenario_.fireRate * deltaTime;
+        if (shotsDue_ < 1)
+            return;
+
+        const Vector2 muzzle = player->getVertices()[2];
+        const Vector2 direction = Vector2Normalize(Vector2Subtract(muzzle, player->getTransform().center));
+        for (; shotsDue_ >= 1; shotsDue_ -= 1)
+            projectiles::ProjectileSystem::Spawn(muzzle, direction * SHOT_SPEED, SHOT_RADIUS, SHOT_DAMAGE);
+    }
+
+    void ScenarioDriver::update(const float deltaTime) {
+        if (!started_) {
+            started_ = true;
+            if (const auto player = game_objects::Player::GetInstance(); player && scenario_.playerHp > 0)
+                player->revive(scenario_.playerHp);
+        }
+
+        steer(deltaTime);
+        fire(deltaTime);
+    }
+
+    void StressReport::addAllocations(AllocationSamples &samples, const core::memory::AllocationStats &stats) {
+        samples.allocations.push_back(static_cast<float>(stats.allocations));
+        samples.bytes.push_back(static_cast<float>(stats.bytes));
+        samples.peakLiveBytes = std::max(samples.peakLiveBytes, stats.peakLiveBytes);
+    }
+
+    void StressReport::addFrame(const EntityCounts &counts) {
+        static std::vector<core::profiling::ZoneSample> samples;
+        core::profiling::Profiler::GetLastFrame(samples);
+
+        for (const auto &[name, time] : samples) {
+            auto [it, inserted] = stageIndex_.try_emplace(name, stages_.size());
+            if (inserted) {
+                // Stage did not run in earlier frames
+                stages_.push_back({name, std::vector<float>(frames_, 0.f)});
+            }
+            stages_[it->second].samples.push_back(time);
+        }
+
+        if constexpr (core::memory::AllocationTracker::ENABLED) {
+            using core::memory::AllocationTracker;
+            for (size_t i = 0; i < core::memory::ALLOCATION_TAG_COUNT; i++)
+                addAllocations(allocations_[i], AllocationTracker::GetLastFrame(static_cast<core::memory::AllocationTag>(i)));
+            addAllocations(allocations_.back(), AllocationTracker::GetLastFrameTotal());
+        }
+        frames_++;
+
+        peaks_.objects = std::max(peaks_.objects, counts.objects);
+        peaks_.asteroids = std::max(peaks_.asteroids, counts.asteroids);
+        peaks_.projectiles = std::max(peaks_.projectiles, counts.projectiles);
+        peaks_.particles = std::max(peaks_.particles, counts.particles);
+        peaks_.animations = std::max(peaks_.animations, counts.animations);
+    }
+
+    bool StressReport::write(const std::string &path, const Scenario &scenario, const double wallSeconds) const {
+        using core::profiling::Percentile;
+
+        FILE *file = std::fopen(path.c_str(), "w");
+        if (file == nullptr) {
+            TraceLog(LOG_WARNING, "SCENARIO: Failed to open %s", path.c_str());
+            return false;
+        }
+
+        std::fprintf(file, "{\n  \"scenario\": \"%s\",\n  \"frames\": %zu,\n  \"dt\": %.6f,\n  \"wall_s\": %.3f,\n",
+                     scenario.name.c_str(), frames_, scenario.deltaTime, wallSeconds);
+
+        std::fputs("  \"stages\": [", file);
+        std::vector<float> sorted;
+        for (size_t i = 0; i < stages_.size(); i++) {
+            sorted = stages_[i].samples;
+            // Stages that stopped running count as zero in the frames after
+            sorted.resize(frames_, 0.f);
+            std::ranges::sort(sorted);
+            std::fprintf(file, "%s\n    {\"name\": \"%s\", \"p50_ms\": %.4f, \"p95_ms\": %.4f, \"p99_ms\": %.4f, \"max_ms\": %.4f}",
+                         i ? "," : "", stages_[i].name.c_str(), Percentile(sorted, 0.5f), Percentile(sorted, 0.95f),
+                         Percentile(sorted, 0.99f), sorted.back());
+        }
+        std::fputs("\n  ],\n", file);
+
+        if (core::memory::AllocationTracker::ENABLED && frames_ > 0) {
+            std::fputs("  \"allocations\": [", file);
+            for (size_t i = 0; i < allocations_.size(); i++) {
+                const AllocationSamples &samples = allocations_[i];
+                const char *tag = i < core::memory::ALLOCATION_TAG_COUNT
+                                      ? core::memory::tagName(static_cast<core::memory::AllocationTag>(i))
+                                      : "total";
+                std::vector<float> allocationsSorted = samples.allocations;
+                std::vector<float> bytesSorted = samples.bytes;
+                std::ranges::sort(allocationsSorted);
+                std::ranges::sort(bytesSorted);
+                std::fprintf(file, "%s\n    {\"tag\": \"%s\", \"allocs_p50\": %.0f, \"allocs_p99\": %.0f, \"allocs_max\": %.0f, "
+                                   "\"bytes_p50\": %.0f, \"bytes_p99\": %.0f, \"bytes_max\": %.0f, \"peak_live_bytes\": %llu}",
+                             i ? "," : "", tag,
+                             Percentile(allocationsSorted, 0.5f), Percentile(allocationsSorted, 0.99f), allocationsSorted.back(),
+                             Percentile(bytesSorted, 0.5f), Percentile(bytesSorted, 0.99f), bytesSorted.back(),
+                             static_cast<unsigned long long>(samples.peakLiveBytes));
+            }
+            std::fputs("\n  ],\n", file);
+        }
+
+        std::fprintf(file, "  \"peaks\": {\"objects\": %zu, \"asteroids\": %zu, \"projectiles\": %zu, "
+                           "\"particles\": %zu, \"animations\": %zu},\n",
+                     peaks_.objects, peaks_.asteroids, peaks_.projectiles, peaks_.particles, peaks_.animations);
+        std::fprintf(file, "  \"memory\": {\"peak_rss_bytes\": %zu}\n}\n", GetPeakResidentBytes());
+        return std::fclose(file) == 0;
+    }
+
+    size_t GetPeakResidentBytes() {
+#ifdef __linux__
+        // High water mark of resident set, in kB
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        while (std::getline(status, line)) {
+            if (line.rfind("VmHWM:", 0) == 0)
+                return std::strtoull(line.c_str() + 6, nullptr, 10) * 1024;
+        }
+#endif
+        return 0;
+    }
+}
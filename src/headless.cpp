@@ -0,0 +1,168 @@
+// Simulation without window or GPU: linked against the null backend instead of raylib.
+// Usage: game_headless [--scenario FILE] [--frames N] [--dt SECONDS] [--seed N] [--input SCRIPT]
+//                      [--world arena|sectors] [--trace FILE] [--report FILE]
+// Options given on the command line override the scenario file, whatever their order
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "core/allocationTracker.h"
+#include "core/animation.h"
+#include "core/input.h"
+#include "core/nullBackend.h"
+#include "core/particleSystem.h"
+#include "core/profiler.h"
+#include "game/gameLoop.h"
+#include "game/gameObjectManager.h"
+#include "game/levelManager.h"
+#include "game/projectileSystem.h"
+#include "game/stressScenario.h"
+#include "UI/buttonSystem.h"
+
+constexpr int screenWidth = 1040;
+constexpr int screenHeight = 1040;
+
+namespace {
+    struct Options {
+        game::stress::Scenario scenario;
+        /// Chrome trace of the last frames, written on exit
+        std::string trace;
+        /// Stage percentiles, peak counts and memory of the whole run, written on exit
+        std::string report;
+    };
+
+    bool parseOptions(const int argc, char **argv, Options &options) {
+        game::stress::Scenario &scenario = options.scenario;
+        for (int i = 1; i < argc; i++) {
+            const bool hasValue = i + 1 < argc;
+            if (!std::strcmp(argv[i], "--scenario") && hasValue)
+                i++;  // Loaded before the rest
+            else if (!std::strcmp(argv[i], "--frames") && hasValue)
+                scenario.frames = std::strtoul(argv[++i], nullptr, 10);
+            else if (!std::strcmp(argv[i], "--dt") && hasValue)
+                scenario.deltaTime = std::strtof(argv[++i], nullptr);
+            else if (!std::strcmp(argv[i], "--seed") && hasValue)
+                scenario.seed = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+            else if (!std::strcmp(argv[i], "--input") && hasValue)
+                scenario.inputScript = argv[++i];
+            else if (!std::strcmp(argv[i], "--trace") && hasValue)
+                options.trace = argv[++i];
+            else if (!std::strcmp(argv[i], "--report") && hasValue)
+                options.report = argv[++i];
+            else if (!std::strcmp(argv[i], "--world") && hasValue) {
+                const char *world = argv[++i];
+                if (!std::strcmp(world, "sectors"))
+                    scenario.level.mode = game::management::WorldMode::SECTORS;
+                else if (!std::strcmp(world, "arena"))
+                    scenario.level.mode = game::management::WorldMode::ARENA;
+                else
+                    return false;
+            }
+            else
+                return false;
+        }
+        return scenario.deltaTime > 0;
+    }
+
+    bool loadScenarioOption(const int argc, char **argv, Options &options) {
+        for (int i = 1; i + 1 < argc; i++) {
+            if (!std::strcmp(argv[i], "--scenario"))
+                return game::stress::LoadScenario(argv[i + 1], options.scenario);
+        }
+        return true;
+    }
+}
+
+int main(const int argc, char **argv) {
+    Options options;
+    if (!loadScenarioOption(argc, argv, options))
+        return 1;
+    if (!parseOptions(argc, argv, options)) {
+        std::fprintf(stderr, "Usage: %s [--scenario FILE] [--frames N] [--dt SECONDS] [--seed N] [--input SCRIPT] "
+                             "[--world arena|sectors] [--trace FILE] [--report FILE]\n",
+                     argv[0]);
+        return 1;
+    }
+    const game::stress::Scenario &scenario = options.scenario;
+
+    core::profiling::Profiler::SetThreadName("Main");
+    InitWindow(screenWidth, screenHeight, "headless");
+    SetRandomSeed(scenario.seed);
+    core::headless::SetFrameTime(scenario.deltaTime);
+    if (!scenario.inputScript.empty() && !core::headless::LoadInputScript(scenario.inputScript)) {
+        std::fprintf(stderr, "Failed to load input script %s\n", scenario.inputScript.c_str());
+        return 1;
+    }
+
+    // Atlas is not built: regions stay invalid and textures empty, which draws nothing anyway
+    core::animation::AnimationSystem::LoadAll();
+    core::particles::ParticleSystem::Init();
+    game::projectiles::ProjectileSystem::Init();
+
+    auto& objectManager = game::management::GameObjectManager::getInstance();
+    const auto levelManager = objectManager.createObject<game::management::LevelManager>(scenario.level);
+
+    game::stress::ScenarioDriver driver(scenario);
+    game::stress::StressReport report;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned long frame = 0; frame < scenario.frames; frame++) {
+        core::headless::BeginFrame();
+        core::profiling::Profiler::BeginFrame();
+        core::memory::AllocationTracker::BeginFrame();
+
+        driver.update(GetFrameTime());
+        // Same hand-over the windowed game does between its threads, here on one
+        core::input::Input::Capture();
+        core::input::Input::BeginTick();
+        game::loop::updateSimulation(GetFrameTime());
+        {
+            ALLOCATION_SCOPE(UI);
+            core::button::ButtonSystem::Update();
+        }
+        game::loop::cleanup();
+        core::memory::AllocationTracker::EndFrame();
+        core::profiling::Profiler::EndFrame();
+
+        if (!options.report.empty()) {
+            report.addFrame({
+                game::management::GameObjectManager::getAllObjects().size(),
+                levelManager->getAsteroidCount(),
+                game::projectiles::ProjectileSystem::GetCount(),
+                core::particles::ParticleSystem::GetCount(),
+                static_cast<size_t>(core::animation::AnimationSystem::GetActiveCount())
+            });
+        }
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::printf("scenario: %s\n", scenario.name.c_str());
+    std::printf("frames: %lu\n", scenario.frames);
+    std::printf("simulated: %.2f s\n", scenario.frames * scenario.deltaTime);
+    std::printf("wall: %.3f s (%.0f frames/s)\n", elapsed.count(),
+                elapsed.count() > 0 ? scenario.frames / elapsed.count() : 0.0);
+    std::printf("objects: %zu asteroids: %zu particles: %zu projectiles: %zu score: %d\n",
+                game::management::GameObjectManager::getAllObjects().size(), levelManager->getAsteroidCount(),
+                core::particles::ParticleSystem::GetCount(),
+                game::projectiles::ProjectileSystem::GetCount(), levelManager->getScore());
+    if (levelManager->getMode() == game::management::WorldMode::SECTORS) {
+        const auto& chunks = levelManager->getChunkedWorld();
+        std::printf("chunks active: %zu stored: %zu live asteroids: %zu records: %zu\n",
+                    chunks.getActiveChunkCount(), chunks.getStoredChunkCount(),
+                    chunks.getLiveCount(), chunks.getRecordCount());
+    }
+
+    if (!options.report.empty() && !report.write(options.report, scenario, elapsed.count()))
+        return 1;
+    if (!options.trace.empty())
+        core::profiling::Profiler::ExportTrace(options.trace.c_str());
+
+    core::animation::AnimationSystem::UnloadAll();
+    core::particles::ParticleSystem::Shutdown();
+    game::projectiles::ProjectileSystem::Shutdown();
+    CloseWindow();
+    return 0;
+}
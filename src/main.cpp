@@ -1,5 +1,7 @@
+#include <cstring>
 #include <iostream>
 
+#include "core/allocationTracker.h"
 #include "core/objectPool.h"
 #include "game/gameObjects.h"
 #include "game/gameObjectManager.h"
@@ -7,11 +9,22 @@
 #include "core/cameraSystem.h"
 #include "UI/buttonSystem.h"
 #include "core/animation.h"
+#include "core/renderQueue.h"
+#include "core/renderCulling.h"
+#include "core/particleSystem.h"
+#include "core/physicsStats.h"
+#include "core/profiler.h"
+#include "core/tiledBackground.h"
+#include "core/textureAtlas.h"
+#include "core/assetPak.h"
+#include "core/assetStreamer.h"
+#include "core/input.h"
 #include "game/levelManager.h"
+#include "game/projectileSystem.h"
+#include "game/simulationThread.h"
 
 constexpr int screenWidth = 1040;
 constexpr int screenHeight = 1040;
-constexpr float deltaTimePhys = 1.f / 60 / 2;
 constexpr Vector2 center = {screenWidth / 2.0f, screenHeight / 2.0f};
 
 using core::object_pool::ObjectPool;
@@ -20,115 +33,120 @@ using game::game_objects::GameObject;
 
 auto& objectManager = game::management::GameObjectManager::getInstance();
 
-components::GameCamera gameCamera;
 
-
-#pragma region SupportFunctions
-
-void updatePhysics() {
-    for (const auto& gameObject : GameObject::s_allObjects) {
-        if (!gameObject->isActive()) continue;
-        gameObject->physUpdate(deltaTimePhys);
-    }
-
-    const auto& collidingObjects = objectManager.getCollidingObjects();
-    for (int i = 0; i < collidingObjects.size(); i++) {
-        if (!collidingObjects[i]->isActive()) continue;
-
-        for (int j = i + 1; j < collidingObjects.size(); j++) {
-            if (!collidingObjects[j]->isActive()) continue;
-
-            if (!collidingObjects[i]->collider->checkCollision(*collidingObjects[j]->collider) or
-                !collidingObjects[j]->collider->checkCollision(*collidingObjects[i]->collider)) continue;
-
-            collidingObjects[i]->onCollided(collidingObjects[j]);
-            collidingObjects[j]->onCollided(collidingObjects[i]);
-        }
+int main(const int argc, char **argv) {
+    // --world sectors: open space streamed in chunks instead of the arena
+    auto worldMode = game::management::WorldMode::ARENA;
+    for (int i = 1; i + 1 < argc; i++) {
+        if (!std::strcmp(argv[i], "--world") && !std::strcmp(argv[i + 1], "sectors"))
+            worldMode = game::management::WorldMode::SECTORS;
     }
-}
 
-#pragma endregion
-
-int main() {
+    // Named before other threads start, so its rows come first in the profiler overlay
+    core::profiling::Profiler::SetThreadName("Main");
     InitWindow(screenWidth, screenHeight, "test");
     SetTargetFPS(60);
-
-    const std::unique_ptr<components::TextureComponent> BackGround = std::make_unique<
-        components::TextureComponent>(textures::background.c_str());
-
-    core::animation::AnimationSystem::LoadAll();
+    // Before anything loads: textures requested from now on decode in background
+    core::streaming::AssetStreamer::Init();
+
+    // Covers the world plus a screen of margin, so the border never shows empty space.
+    // Tiles repeat one image, so open space just gets an area nobody flies out of
+    const float backgroundExtent = worldMode == game::management::WorldMode::SECTORS
+                                       ? 1e6f
+                                       : WORLD_RADIUS + screenWidth;
+    core::render::TiledBackground background(
+        textures::background,
+        {center.x - backgroundExtent, center.y - backgroundExtent, 2 * backgroundExtent, 2 * backgroundExtent});
+
+    {
+        ALLOCATION_SCOPE(ASSETS);
+        // Cooked pak uploads without decoding anything; sources are the fallback
+        if (!core::pak::AssetPak::Load(textures::assetPak))
+            core::atlas::TextureAtlas::LoadAll();
+        core::animation::AnimationSystem::LoadAll();
+    }
+    core::particles::ParticleSystem::Init();
+    game::projectiles::ProjectileSystem::Init();
     // Initialize camera
+    components::GameCamera gameCamera;
     gameCamera.camera.offset = center;
     gameCamera.smoothSpeed = 5.0f;
     gameCamera.zoom = 0.75f;
 
-    float DT = 0;
+    const auto levelManager = objectManager.createObject<game::management::LevelManager>(worldMode);
 
-    const auto levelManager = objectManager.createObject<game::management::LevelManager>();
+    // World is simulated and recorded into snapshots there; this thread only polls input,
+    // uploads streamed textures and draws the newest snapshot
+    game::simulation::SimulationThread simulation(gameCamera, levelManager);
+    simulation.start();
 
     while (!WindowShouldClose()) {
-        const float frameTime = GetFrameTime(); // Store frame time for camera smoothing
+        core::profiling::Profiler::BeginFrame();
+        core::memory::AllocationTracker::BeginFrame();
 
-        core::animation::AnimationSystem::Update(frameTime);
-        
+        if (IsKeyPressed(KEY_F3))
+            core::profiling::Profiler::ToggleOverlay();
+        if (IsKeyPressed(KEY_F4))
+            core::profiling::Profiler::ExportTrace(TextFormat("trace_%.0f.json", GetTime() * 1000));
 
-        // Physics update
-        DT += frameTime;
-        while (DT > deltaTimePhys) {
-            updatePhysics();
-            DT -= deltaTimePhys;
-        }
+        core::input::Input::Capture();
+        core::streaming::AssetStreamer::Update();
 
-        // Logic
-        for (const auto& gameObject : game::management::GameObjectManager::getAllObjects()) {
-            if (!gameObject->isActive()) continue;
-            gameObject->logicUpdate();
-        }
-
-        // Update camera before rendering
-        core::systems::CameraSystem::UpdateCamera(
-            gameCamera,
-            *game::game_objects::Player::GetInstance(),
-            frameTime
-        );
-
-        core::button::ButtonSystem::Update();
+        const game::simulation::RenderSnapshot &snapshot = simulation.acquireSnapshot();
 
         // Rendering
-        BeginDrawing();
-        ClearBackground(RAYWHITE);
-
-        // Begin camera mode
-        core::systems::CameraSystem::BeginCameraDraw(gameCamera);
-
-        BackGround->Draw(components::Transform2D(
-            center.x, center.y, BackGround->getTexture().width,
-            BackGround->getTexture().height));
-
-
-        for (auto* drawnObj : objectManager.getDrawnObjects()) {
-            if (!drawnObj->isActive()) continue;
-
-            drawnObj->draw();
+        {
+            ALLOCATION_SCOPE(RENDER);
+            PROFILE_ZONE("Draw");
+            BeginDrawing();
+            ClearBackground(RAYWHITE);
+
+            // Nothing to show before the first tick
+            if (snapshot.tick > 0) {
+                core::systems::CameraSystem::BeginCameraDraw(snapshot.camera);
+
+                background.draw(snapshot.view, snapshot.camera.camera.zoom);
+                // Background goes first so borders recorded in snapshot stay above it
+                core::render::RenderQueue::Flush();
+                core::render::RenderQueue::Draw(snapshot.world);
+
+                core::systems::CameraSystem::EndCameraDraw();
+            }
+
+            // Draw UI elements that shouldn't move with camera (like FPS counter)
+            DrawFPS(10, 10);
+            DrawText(TextFormat("Score: %d", snapshot.score),
+                10, 70, 20, RED);
+            DrawText(TextFormat("Drawn: %d Culled: %d", snapshot.culling.drawn, snapshot.culling.culled),
+                10, 40, 20, DARKGRAY);
+            // Profiler overlay with allocation and collision tables stacked under it
+            if (int overlayY = 10 + core::profiling::Profiler::DrawOverlay(screenWidth - 320, 10); overlayY > 10) {
+                overlayY += 4 + core::physics_stats::PhysicsStats::DrawOverlay(snapshot.physics, screenWidth - 320,
+                                                                               overlayY + 4);
+                core::memory::AllocationTracker::DrawOverlay(screenWidth - 320, overlayY + 4);
+            }
         }
 
-        core::animation::AnimationSystem::Draw();
-        //
-        core::button::ButtonSystem::Draw(game::game_objects::Player::GetInstance()->getTransform());
-
-        core::systems::CameraSystem::EndCameraDraw();
-
-        // Draw UI elements that shouldn't move with camera (like FPS counter)
-        DrawFPS(10, 10);
-        DrawText(TextFormat("Score: %d", levelManager->getScore()),
-            10, 70, 20, RED);
-
-        EndDrawing();
+        {
+            // Includes waiting for vsync / target FPS
+            ALLOCATION_SCOPE(RENDER);
+            PROFILE_ZONE("Present");
+            EndDrawing();
+        }
 
-        // Cleanup
-        objectManager.destroyObjectsToDestroy();
+        core::memory::AllocationTracker::EndFrame();
+        core::profiling::Profiler::EndFrame();
     }
 
+    // World goes back to this thread before anything it uses is unloaded
+    simulation.stop();
+
     core::animation::AnimationSystem::UnloadAll();
+    core::particles::ParticleSystem::Shutdown();
+    game::projectiles::ProjectileSystem::Shutdown();
+    core::atlas::TextureAtlas::UnloadAll();
+    core::pak::AssetPak::Unload();
+    background.unload();
+    core::streaming::AssetStreamer::Shutdown();
     return 0;
 }
@@ -0,0 +1,208 @@
+// Authoritative session without window or GPU: headless simulation sending snapshots over UDP.
+// Usage: game_server [--port N] [--scenario FILE] [--world arena|sectors] [--seed N] [--input SCRIPT]
+//                    [--seconds N] [--unpaced]
+// Runs until --seconds pass or Ctrl+C. Prints simulation time, bandwidth and CPU per client every second.
+// --unpaced runs ticks back to back, for how many sessions one box can hold
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include "core/animation.h"
+#include "core/input.h"
+#include "core/nullBackend.h"
+#include "core/particleSystem.h"
+#include "game/gameLoop.h"
+#include "game/gameObjectManager.h"
+#include "game/levelManager.h"
+#include "game/netServer.h"
+#include "game/projectileSystem.h"
+#include "game/stressScenario.h"
+#include "UI/buttonSystem.h"
+
+namespace {
+    struct Options {
+        game::stress::Scenario scenario;
+        uint16_t port = game::net::DEFAULT_PORT;
+        /// Zero runs until interrupted
+        double seconds = 0;
+        bool unpaced = false;
+    };
+
+    volatile std::sig_atomic_t s_interrupted = 0;
+
+    bool parseOptions(const int argc, char **argv, Options &options) {
+        game::stress::Scenario &scenario = options.scenario;
+        for (int i = 1; i < argc; i++) {
+            const bool hasValue = i + 1 < argc;
+            if (!std::strcmp(argv[i], "--scenario") && hasValue)
+                i++;  // Loaded before the rest
+            else if (!std::strcmp(argv[i], "--port") && hasValue) {
+                char *end;
+                const unsigned long port = std::strtoul(argv[++i], &end, 10);
+                // Zero binds any free port; anything past 65535 would wrap to another one
+                if (end == argv[i] || *end != '\0' || port > 65535)
+                    return false;
+                options.port = static_cast<uint16_t>(port);
+            }
+            else if (!std::strcmp(argv[i], "--seconds") && hasValue)
+                options.seconds = std::strtod(argv[++i], nullptr);
+            else if (!std::strcmp(argv[i], "--unpaced"))
+                options.unpaced = true;
+            else if (!std::strcmp(argv[i], "--seed") && hasValue)
+                scenario.seed = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+            else if (!std::strcmp(argv[i], "--input") && hasValue)
+                scenario.inputScript = argv[++i];
+            else if (!std::strcmp(argv[i], "--world") && hasValue) {
+                const char *world = argv[++i];
+                if (!std::strcmp(world, "sectors"))
+                    scenario.level.mode = game::management::WorldMode::SECTORS;
+                else if (!std::strcmp(world, "arena"))
+                    scenario.level.mode = game::management::WorldMode::ARENA;
+                else
+                    return false;
+            }
+            else
+                return false;
+        }
+        return options.seconds >= 0;
+    }
+
+    bool loadScenarioOption(const int argc, char **argv, Options &options) {
+        for (int i = 1; i + 1 < argc; i++) {
+            if (!std::strcmp(argv[i], "--scenario"))
+                return game::stress::LoadScenario(argv[i + 1], options.scenario);
+        }
+        return true;
+    }
+
+    void printStats(const char *label, const unsigned long ticks, const double simSeconds, const double wallSeconds,
+                    const size_t clients, const game::net::ServerStats &stats) {
+        const double snapshots = static_cast<double>(stats.snapshots);
+        std::printf("%s: ticks %lu | clients %zu | sim %.3f ms/tick | net %.1f us/client/tick (+%.1f send) | "
+                    "out %.1f KB/s/client, %.0f B/snapshot, %.1f%% full\n",
+                    label, ticks, clients,
+                    ticks > 0 ? simSeconds * 1e3 / static_cast<double>(ticks) : 0.0,
+                    snapshots > 0 ? stats.cpuSeconds * 1e6 / snapshots : 0.0,
+                    snapshots > 0 ? stats.sendSeconds * 1e6 / snapshots : 0.0,
+                    // Bytes of an average snapshot at the tick rate achieved, so clients coming
+                    // and going within the interval do not skew it
+                    snapshots > 0 && wallSeconds > 0
+                        ? static_cast<double>(stats.bytesSent) / snapshots * static_cast<double>(ticks) / wallSeconds / 1024
+                        : 0.0,
+                    snapshots > 0 ? static_cast<double>(stats.bytesSent) / snapshots : 0.0,
+                    snapshots > 0 ? 100.0 * static_cast<double>(stats.fullSnapshots) / snapshots : 0.0);
+        std::fflush(stdout);
+    }
+}
+
+int main(const int argc, char **argv) {
+    Options options;
+    if (!loadScenarioOption(argc, argv, options))
+        return 1;
+    if (!parseOptions(argc, argv, options)) {
+        std::fprintf(stderr, "Usage: %s [--port N] [--scenario FILE] [--world arena|sectors] [--seed N] "
+                             "[--input SCRIPT] [--seconds N] [--unpaced]\n",
+                     argv[0]);
+        return 1;
+    }
+    const game::stress::Scenario &scenario = options.scenario;
+
+    game::net::Server server;
+    if (!server.open(options.port)) {
+        std::fprintf(stderr, "Failed to open UDP port %u\n", options.port);
+        return 1;
+    }
+    std::printf("listening on port %u\n", server.getPort());
+    std::signal(SIGINT, [](int) { s_interrupted = 1; });
+
+    InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "server");
+    SetRandomSeed(scenario.seed);
+    // Simulation always steps by one tick; pacing, if any, is real time below
+    core::headless::SetFrameTime(static_cast<float>(1 / game::net::TICK_RATE));
+    if (!scenario.inputScript.empty() && !core::headless::LoadInputScript(scenario.inputScript)) {
+        std::fprintf(stderr, "Failed to load input script %s\n", scenario.inputScript.c_str());
+        return 1;
+    }
+
+    core::animation::AnimationSystem::LoadAll();
+    core::particles::ParticleSystem::Init();
+    game::projectiles::ProjectileSystem::Init();
+
+    auto& objectManager = game::management::GameObjectManager::getInstance();
+    const auto levelManager = objectManager.createObject<game::management::LevelManager>(scenario.level);
+    game::stress::ScenarioDriver driver(scenario);
+
+    using Clock = std::chrono::steady_clock;
+    const auto tickDuration = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(1 / game::net::TICK_RATE));
+    const auto start = Clock::now();
+    auto nextTick = start;
+    auto lastReport = start;
+
+    uint32_t tick = 0;
+    double simSeconds = 0;
+    unsigned long intervalTicks = 0;
+    double intervalSimSeconds = 0;
+    game::net::ServerStats intervalStart;
+
+    while (!s_interrupted) {
+        const auto now = Clock::now();
+        const double elapsed = std::chrono::duration<double>(now - start).count();
+        if (options.seconds > 0 && elapsed >= options.seconds)
+            break;
+
+        server.receive(elapsed);
+
+        const auto simStart = Clock::now();
+        core::headless::BeginFrame();
+        driver.update(GetFrameTime());
+        core::input::Input::Capture();
+        core::input::Input::BeginTick();
+        game::loop::updateSimulation(GetFrameTime());
+        core::button::ButtonSystem::Update();
+        const double tickSimSeconds = std::chrono::duration<double>(Clock::now() - simStart).count();
+
+        // Ticks start at one: clients ack zero until they have a snapshot
+        server.broadcast(++tick, levelManager->getScore());
+
+        const auto cleanupStart = Clock::now();
+        game::loop::cleanup();
+        const double cleanupSeconds = std::chrono::duration<double>(Clock::now() - cleanupStart).count();
+
+        simSeconds += tickSimSeconds + cleanupSeconds;
+        intervalSimSeconds += tickSimSeconds + cleanupSeconds;
+        intervalTicks++;
+
+        if (const auto reportTime = Clock::now(); reportTime - lastReport >= std::chrono::seconds(1)) {
+            const game::net::ServerStats &stats = server.getStats();
+            printStats("interval", intervalTicks, intervalSimSeconds,
+                       std::chrono::duration<double>(reportTime - lastReport).count(),
+                       server.getClientCount(), stats - intervalStart);
+            intervalStart = stats;
+            intervalTicks = 0;
+            intervalSimSeconds = 0;
+            lastReport = reportTime;
+        }
+
+        if (!options.unpaced) {
+            nextTick += tickDuration;
+            // Fell behind by more than a tick: start counting again instead of bursting
+            if (Clock::now() > nextTick + tickDuration)
+                nextTick = Clock::now();
+            std::this_thread::sleep_until(nextTick);
+        }
+    }
+
+    const double wall = std::chrono::duration<double>(Clock::now() - start).count();
+    printStats("total", tick, simSeconds, wall, server.getClientCount(), server.getStats());
+
+    core::animation::AnimationSystem::UnloadAll();
+    core::particles::ParticleSystem::Shutdown();
+    game::projectiles::ProjectileSystem::Shutdown();
+    CloseWindow();
+    return 0;
+}
@@ -0,0 +1,29 @@
+// Offline asset cooker: packs every sprite of the asset manifest into one pak file.
+// Usage: asset_cooker [OUTPUT]   (default is textures::assetPak)
+
+#include <cstdio>
+
+#include "assetManifest.h"
+#include "core/assetPak.h"
+#include "texturePaths.h"
+
+int main(const int argc, char **argv) {
+    if (argc > 2) {
+        std::fprintf(stderr, "Usage: %s [OUTPUT]\n", argv[0]);
+        return 1;
+    }
+    const std::string output = argc == 2 ? argv[1] : textures::assetPak;
+
+    std::vector<core::pak::SheetSource> sheets;
+    for (const auto &texture : assets::TEXTURES) {
+        sheets.push_back({std::string(texture.name), texture.path, texture.rows, texture.columns});
+    }
+
+    std::vector<core::pak::AnimationSource> animations;
+    for (const auto &animation : assets::ANIMATIONS) {
+        animations.push_back({std::string(animation.name), std::string(assets::info(animation.sheet).name),
+                              animation.frameDuration, animation.looping});
+    }
+
+    return core::pak::Cook(sheets, animations, output) ? 0 : 1;
+}